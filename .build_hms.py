@@ -0,0 +1,199 @@
+import json
+import os
+
+# Compiles docs/codes.json into src/HmsDatabaseData.h, the flash resident table behind HmsDatabase.
+#
+# Every HMS code ((attr << 32) | code) and every print_error code is a key in a minimal perfect hash
+# (hash and displace): the bucket hash picks a seed, the seed hashes the key to its slot. Lookup is two
+# hashes and a compare whatever the table size.
+#
+# Messages are stored once each. Each is a list of word ids, one byte for the 128 most common words and
+# two bytes for the rest, the words themselves being stored once in a dictionary.
+#
+# The generated header is committed, so a build without this script (or without codes.json) still works.
+# It is only regenerated when codes.json or this script is newer.
+
+try:
+    Import("env")
+    project_dir = env["PROJECT_DIR"]
+except NameError:
+    project_dir = os.getcwd()
+
+SOURCE = os.path.join(project_dir, "docs", "codes.json")
+OUTPUT = os.path.join(project_dir, "src", "HmsDatabaseData.h")
+SCRIPT = os.path.join(project_dir, ".build_hms.py")
+
+MASK64 = (1 << 64) - 1
+
+# Must match HmsDatabase::hash()
+def hash_key(key, seed):
+    h = key ^ ((seed * 0x9E3779B97F4A7C15) & MASK64)
+    h ^= h >> 33
+    h = (h * 0xFF51AFD7ED558CCD) & MASK64
+    h ^= h >> 33
+    h = (h * 0xC4CEB93FE53E4F77) & MASK64
+    h ^= h >> 33
+    return h & 0xFFFFFFFF
+
+def load_codes():
+    with open(SOURCE, "r", encoding="utf-8") as f:
+        data = json.load(f)["data"]
+
+    codes = {}
+    for section in ("device_hms", "device_error"):
+        for entry in data[section]["en"]:
+            key = int(entry["ecode"], 16)
+            if key in codes and codes[key] != entry["intro"]:
+                raise Exception("Code " + entry["ecode"] + " has two different messages")
+            codes[key] = entry["intro"]
+
+    return data["device_hms"]["ver"], codes
+
+def build_hash(keys):
+    n = len(keys)
+    buckets = [[] for i in range(n)]
+    for key in keys:
+        buckets[hash_key(key, 0) % n].append(key)
+
+    seeds = [0] * n
+    slots = [None] * n
+    order = sorted(range(n), key=lambda b: len(buckets[b]), reverse=True)
+
+    for b in order:
+        bucket = buckets[b]
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        while True:
+            placed = set()
+            for key in bucket:
+                slot = hash_key(key, seed) % n
+                if slots[slot] is not None or slot in placed:
+                    break
+                placed.add(slot)
+            else:
+                break
+            seed += 1
+            if seed > 0x7FFF:
+                raise Exception("Couldn't place bucket " + str(b))
+        for key in bucket:
+            slots[hash_key(key, seed) % n] = key
+        seeds[b] = seed
+
+    # Single key buckets go straight into a free slot, stored as -(slot + 1)
+    free = [i for i in range(n) if slots[i] is None]
+    for b in order:
+        if len(buckets[b]) == 1:
+            slot = free.pop()
+            slots[slot] = buckets[b][0]
+            seeds[b] = -(slot + 1)
+
+    return seeds, slots
+
+def build_text(messages):
+    counts = {}
+    for message in messages:
+        for word in message.split(" "):
+            counts[word] = counts.get(word, 0) + 1
+
+    words = sorted(counts, key=lambda w: (-counts[w], w))
+    ids = {word: i for i, word in enumerate(words)}
+    if len(words) > 0x7FFF:
+        raise Exception("Too many distinct words")
+
+    text = bytearray()
+    offsets = []
+    for message in messages:
+        offsets.append(len(text))
+        for word in message.split(" "):
+            id = ids[word]
+            if id < 0x80:
+                text.append(id)
+            else:
+                text.append(0x80 | (id >> 8))
+                text.append(id & 0xFF)
+    offsets.append(len(text))
+    if len(text) > 0xFFFF:
+        raise Exception("Encoded messages don't fit 16 bit offsets")
+
+    dictionary = bytearray()
+    word_offsets = []
+    for word in words:
+        word_offsets.append(len(dictionary))
+        dictionary += word.encode("utf-8")
+    word_offsets.append(len(dictionary))
+    if len(dictionary) > 0xFFFF:
+        raise Exception("Dictionary doesn't fit 16 bit offsets")
+
+    return text, offsets, dictionary, word_offsets
+
+def c_string(data):
+    out = ""
+    for b in data:
+        c = chr(b)
+        if c == '"' or c == "\\":
+            out += "\\" + c
+        elif 32 <= b < 127:
+            out += c
+        else:
+            out += "\\%03o" % b
+    return '"' + out + '"'
+
+def c_array(values, width=12):
+    lines = []
+    for i in range(0, len(values), width):
+        lines.append("    " + ", ".join(values[i:i + width]))
+    return ",\n".join(lines)
+
+def c_strings(data, width=96):
+    lines = []
+    for i in range(0, len(data), width):
+        lines.append("    " + c_string(data[i:i + width]))
+    return "\n".join(lines) if lines else '    ""'
+
+def generate():
+    version, codes = load_codes()
+    keys = sorted(codes)
+    seeds, slots = build_hash(keys)
+
+    messages = sorted(set(codes.values()))
+    message_ids = {message: i for i, message in enumerate(messages)}
+    text, offsets, dictionary, word_offsets = build_text(messages)
+    longest = max(len(m.encode("utf-8")) for m in messages)
+
+    with open(OUTPUT, "w", newline="\n") as f:
+        f.write("// Generated by .build_hms.py from docs/codes.json, do not edit.\n")
+        f.write("#ifndef HMS_DATABASE_DATA_H_\n#define HMS_DATABASE_DATA_H_\n\n")
+        f.write("#include <stdint.h>\n\n")
+        f.write('#define HMS_DB_VERSION "%s"\n' % version)
+        f.write("#define HMS_DB_NUM_CODES %d\n" % len(keys))
+        f.write("#define HMS_DB_NUM_MESSAGES %d\n" % len(messages))
+        f.write("#define HMS_DB_NUM_WORDS %d\n" % (len(word_offsets) - 1))
+        f.write("#define HMS_DB_LONGEST_MESSAGE %d\n\n" % longest)
+
+        f.write("// Per bucket seed, or -(slot + 1) for buckets holding a single code\n")
+        f.write("static const int16_t HMS_DB_SEEDS[HMS_DB_NUM_CODES] = {\n%s\n};\n\n" % c_array([str(s) for s in seeds]))
+        f.write("static const uint64_t HMS_DB_CODES[HMS_DB_NUM_CODES] = {\n%s\n};\n\n" % c_array(["0x%016X" % k for k in slots], 4))
+        f.write("static const uint16_t HMS_DB_MESSAGE_IDS[HMS_DB_NUM_CODES] = {\n%s\n};\n\n" % c_array([str(message_ids[codes[k]]) for k in slots]))
+        f.write("static const uint16_t HMS_DB_MESSAGE_OFFSETS[HMS_DB_NUM_MESSAGES + 1] = {\n%s\n};\n\n" % c_array([str(o) for o in offsets]))
+        f.write("static const uint8_t HMS_DB_MESSAGE_TEXT[] = {\n%s\n};\n\n" % c_array(["0x%02X" % b for b in text], 16))
+        f.write("static const uint16_t HMS_DB_WORD_OFFSETS[HMS_DB_NUM_WORDS + 1] = {\n%s\n};\n\n" % c_array([str(o) for o in word_offsets]))
+        f.write("static const char HMS_DB_WORDS[] =\n%s;\n\n" % c_strings(dictionary))
+        f.write("#endif /* HMS_DATABASE_DATA_H_ */\n")
+
+    print("Generated HMS database: %d codes, %d messages, %d words" % (len(keys), len(messages), len(word_offsets) - 1))
+
+def is_stale():
+    if not os.path.exists(OUTPUT):
+        return True
+    built = os.path.getmtime(OUTPUT)
+    return os.path.getmtime(SOURCE) > built or (os.path.exists(SCRIPT) and os.path.getmtime(SCRIPT) > built)
+
+if not os.path.exists(SOURCE):
+    print("WARNING: docs/codes.json not found. Using pre-built HMS database.")
+elif is_stale():
+    try:
+        generate()
+    except Exception as e:
+        print("Encountered error", type(e).__name__, "building HMS database:", e)
+        print("WARNING: Failed to build HMS database. Using pre-built one.")
@@ -1,5 +1,6 @@
 #include "BambuLights.h"
 #include <math.h>
+#include "esp_heap_caps.h"
 
 //#define DEBUG_COLORS
 //#define DEBUG_FADE
@@ -166,6 +167,57 @@ CompositeConfigItem& BambuLights::getFinishedConfig() {
     return config;
 }
 
+CompositeConfigItem& BambuLights::getSegment1Config() {
+    static IntConfigItem start("start", 0);
+    static IntConfigItem length("length", 0);  // 0 = not used
+    static ByteConfigItem mode("mode", segmentReactive);
+
+    static BaseConfigItem* configSet[] {
+        &start,
+        &length,
+        &mode,
+        0
+    };
+
+    static CompositeConfigItem config("segment1", 0, configSet);
+
+    return config;
+}
+
+CompositeConfigItem& BambuLights::getSegment2Config() {
+    static IntConfigItem start("start", 0);
+    static IntConfigItem length("length", 0);  // 0 = not used
+    static ByteConfigItem mode("mode", segmentReactive);
+
+    static BaseConfigItem* configSet[] {
+        &start,
+        &length,
+        &mode,
+        0
+    };
+
+    static CompositeConfigItem config("segment2", 0, configSet);
+
+    return config;
+}
+
+CompositeConfigItem& BambuLights::getSegment3Config() {
+    static IntConfigItem start("start", 0);
+    static IntConfigItem length("length", 0);  // 0 = not used
+    static ByteConfigItem mode("mode", segmentReactive);
+
+    static BaseConfigItem* configSet[] {
+        &start,
+        &length,
+        &mode,
+        0
+    };
+
+    static CompositeConfigItem config("segment3", 0, configSet);
+
+    return config;
+}
+
 CompositeConfigItem& BambuLights::getAllConfig() {
     static BaseConfigItem* configSet[] {
         &getNoWiFiConfig(),
@@ -176,10 +228,23 @@ CompositeConfigItem& BambuLights::getAllConfig() {
         &getWarningConfig(),
         &getFinishedConfig(),
         &getLedType(),
-        &getNumLEDs(),
+        &getLegacyNumLEDs(),
         &getLightMode(),
         &getLightState(),
         &getChamberSync(),
+        &getFadeTime(),
+        &getSegment1Config(),
+        &getSegment2Config(),
+        &getSegment3Config(),
+        &getLedPins(),
+        &getMaxLEDs(),
+        &getGamma(),
+        &getRedBalance(),
+        &getGreenBalance(),
+        &getBlueBalance(),
+        &getDithering(),
+        &getMaxMilliamps(),
+        &getNumLEDs(),
 	      0
     };
 
@@ -188,29 +253,203 @@ CompositeConfigItem& BambuLights::getAllConfig() {
     return config;
 };
 
+bool BambuLights::migrateConfig() {
+  // Settings are stored by position, so the count couldn't just be widened where it was.
+  // The old byte stays in its slot and is copied to the int at the end, once.
+  ByteConfigItem& legacy = getLegacyNumLEDs();
+  if (legacy == 0) {
+    return false;
+  }
+
+  getNumLEDs() = (int)legacy;
+  getNumLEDs().put();
+  legacy = 0;
+  legacy.put();
+
+  return true;
+}
+
 BambuLights::BambuLights(int pin) :
-    pixels(new NeoPixelBus <NeoGrbFeature, Neo800KbpsMethod>(getNumLEDs(), pin)),
     pin(pin),
+    frame(getLEDCount(), getReservedLEDCount()),
     currentState(noWiFi)
 {
+    createOutput(getReservedLEDCount());
     setCurrentConfig(getNoWiFiConfig());
+    setSegmentConfig(0, getSegment1Config());
+    setSegmentConfig(1, getSegment2Config());
+    setSegmentConfig(2, getSegment3Config());
+}
+
+uint16_t BambuLights::getLEDCount() {
+  int count = getNumLEDs();
+  if (count < 0 || count > MAX_LEDS) {
+    return 36;
+  }
+  return count;
+}
+
+uint16_t BambuLights::getReservedLEDCount() {
+  int capacity = getMaxLEDs();
+  if (capacity < 0 || capacity > MAX_LEDS) {
+    capacity = 0;
+  }
+  return max((int)getLEDCount(), capacity);
+}
+
+void BambuLights::createOutput(uint16_t capacity) {
+  outputType = getLedType();
+  output = LedOutput::create(outputType);
+  applyCorrection();
+  applyPowerLimit();
+
+  uint8_t pins[LedOutput::MAX_OUTPUTS];
+  uint8_t numPins = LedOutput::parsePins(getLedPins(), pin, pins);
+  output->configure(getLEDCount(), capacity, pins, numPins);
 }
 
-void BambuLights::updatePixelCount() {
-  if (pixels->PixelCount() != getNumLEDs()) {
-    pixels->ClearTo(0);
-    show();
-    pixels->Dirty();
-    show();
-    delete pixels;
-    pixels = new NeoPixelBus <NeoGrbFeature, Neo800KbpsMethod>(getNumLEDs(), pin);
-    begin();
+void BambuLights::setSegmentConfig(uint8_t segment, CompositeConfigItem& config) {
+  segments[segment].start = (IntConfigItem*)config.get("start");
+  segments[segment].length = (IntConfigItem*)config.get("length");
+  segments[segment].mode = (ByteConfigItem*)config.get("mode");
+}
+
+uint8_t BambuLights::getSpans(Span *spans, bool wholeStrip) {
+  uint16_t count = frame.getCount();
+
+  // Every segment edge splits the strip
+  uint16_t edges[2 * NUM_SEGMENTS + 2];
+  uint8_t numEdges = 0;
+  edges[numEdges++] = 0;
+  edges[numEdges++] = count;
+
+  uint16_t starts[NUM_SEGMENTS];
+  uint16_t ends[NUM_SEGMENTS];
+  for (uint8_t i=0; i < NUM_SEGMENTS; i++) {
+    int start = *segments[i].start;
+    int length = *segments[i].length;
+    if (wholeStrip || start < 0 || length <= 0) {
+      starts[i] = ends[i] = 0;
+      continue;
+    }
+    starts[i] = min(start, (int)count);
+    ends[i] = min(start + length, (int)count);
+    edges[numEdges++] = starts[i];
+    edges[numEdges++] = ends[i];
+  }
+
+  // Insertion sort, there are only a handful
+  for (uint8_t i=1; i < numEdges; i++) {
+    uint16_t edge = edges[i];
+    uint8_t j = i;
+    for (; j > 0 && edges[j-1] > edge; j--) {
+      edges[j] = edges[j-1];
+    }
+    edges[j] = edge;
+  }
+
+  uint8_t numSpans = 0;
+  for (uint8_t i=1; i < numEdges; i++) {
+    uint16_t from = edges[i-1];
+    uint16_t to = edges[i];
+    if (from == to) {
+      continue;
+    }
+
+    // Anything not in a segment follows the printer. Later segments win where they overlap.
+    uint8_t mode = segmentReactive;
+    for (uint8_t seg=0; seg < NUM_SEGMENTS; seg++) {
+      if (starts[seg] <= from && to <= ends[seg]) {
+        mode = *segments[seg].mode;
+      }
+    }
+
+    if (numSpans > 0 && spans[numSpans-1].mode == mode) {
+      spans[numSpans-1].length += to - from;
+    } else {
+      spans[numSpans].start = from;
+      spans[numSpans].length = to - from;
+      spans[numSpans].mode = mode;
+      numSpans++;
+    }
   }
+
+  return numSpans;
+}
+
+void BambuLights::requestUpdate(uint8_t update) {
+  __atomic_fetch_or(&pendingUpdates, update, __ATOMIC_RELEASE);
+  wake();
 }
 
+// On the LED task, so nothing is resized or replaced while it is being written out
+void BambuLights::applyUpdates() {
+  uint8_t updates = __atomic_exchange_n(&pendingUpdates, 0, __ATOMIC_ACQUIRE);
+
+  if (updates & UPDATE_PIXEL_COUNT) {
+    applyPixelCount();
+  }
+  if (updates & UPDATE_CORRECTION) {
+    applyCorrection();
+  }
+  if (updates & UPDATE_POWER_LIMIT) {
+    applyPowerLimit();
+  }
+}
+
+void BambuLights::applyPixelCount() {
+  frame.markDirty();
+
+  uint8_t pins[LedOutput::MAX_OUTPUTS];
+  uint8_t numPins = LedOutput::parsePins(getLedPins(), pin, pins);
+  bool typeChanged = getLedType() != outputType;
+  if (typeChanged || !output->isConfigured(getLEDCount(), pins, numPins)) {
+    largestFreeBeforeResize = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    output->clear();
+    if (typeChanged) {
+      // A different pixel layout, so the buses have to be replaced
+      uint16_t capacity = output->getCapacity();
+      delete output;
+      createOutput(capacity);
+      output->begin();
+    } else if (output->configure(getLEDCount(), output->getCapacity(), pins, numPins)) {
+      // Only reallocates if the new count doesn't fit in what was reserved at boot, or the pins changed
+      output->begin();
+    }
+    frame.resize(getLEDCount());
+    // The frame is black now, so whatever effect was drawing has to start over
+    currentEffect = 0;
+    largestFreeAfterResize = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+  }
+}
+
+void BambuLights::applyCorrection() {
+  output->setCorrection(getGamma(), getRedBalance(), getGreenBalance(), getBlueBalance());
+  output->setDithering(getDithering());
+  frame.markDirty();
+}
+
+void BambuLights::applyPowerLimit() {
+  int maxMilliamps = getMaxMilliamps();
+  output->setMaxMilliamps(maxMilliamps > 0 ? maxMilliamps : 0);
+  frame.markDirty();
+}
+
+#ifdef DEBUG_FADE
+void printCHSV(const CHSV& color) {
+  Serial.print("{h=");Serial.print(color.h);
+  Serial.print(",s=");Serial.print(color.s);
+  Serial.print(",v=");Serial.print(color.v);
+  Serial.print("}");
+}
+#endif
+
 void BambuLights::setState(State state) {
   if (currentState != state) {
     currentState = state;
+    if (!changeMicros) {
+      changeMicros = micros();
+    }
 
 // noWiFi, noPrinter, printer, printing, no_lights, white, warning, error, finished
     bool oldBlack = black;
@@ -218,8 +457,13 @@ void BambuLights::setState(State state) {
     byte oldPattern = *currentPattern;
     black = false;
     brightWhite = false;
+    uint32_t now = millis();
+    bool retarget = fade.isActive();
     CHSV oldColor = {*currentHue, *currentSaturation, *currentValue};
-    if (oldPattern == pulse) {
+    if (retarget) {
+      // Re-aim the fade in flight from wherever it has got to
+      oldColor = fade.current(now);
+    } else if (oldPattern == pulse) {
       oldColor.v = getPulseBrightness();
     }
     // Serial.print("state set to ");Serial.println(state);
@@ -260,7 +504,7 @@ void BambuLights::setState(State state) {
         newColor.h = oldColor.h;
         newColor.s = oldColor.s;
         newColor.v = 0;
-      } else {
+      } else if (!retarget) {
         // Fade from new color at zero brightness to new color
         oldColor.h = newColor.h;
         oldColor.s = newColor.s;
@@ -273,7 +517,7 @@ void BambuLights::setState(State state) {
         newColor.h = oldColor.h;
         newColor.s = 0;
         newColor.v = 255;
-      } else {
+      } else if (!retarget) {
         // Fade from new color at zero saturation (aka white) and full brightness to new color
         oldColor.h = newColor.h;
         oldColor.s = 0;
@@ -281,11 +525,14 @@ void BambuLights::setState(State state) {
       }
     }
 
-    crossFade(oldColor, newColor);
+#ifdef DEBUG_FADE
+    Serial.print("Blending from ");printCHSV(oldColor);Serial.print(" to ");printCHSV(newColor);Serial.println("");
+#endif
+    // Negative makes no sense, but anything longer than 65 s is just a slow fade
+    uint32_t fadeTime = max((int)getFadeTime(), 0);
+    fade.start(oldColor, newColor, now, fadeTime);
 
-    if (*currentPattern == pulse) {
-      pulseOffset = millis(); // Always start at brightest level
-    }
+    pulseOffset = now + fadeTime; // Always start at brightest level once the fade is done
   }
 }
 
@@ -299,11 +546,130 @@ void BambuLights::setCurrentConfig(CompositeConfigItem& config) {
 }
 
 void BambuLights::begin()  {
-	pixels->Begin(); // This initializes the NeoPixel library.
-	pixels->Show();
+	task = xTaskGetCurrentTaskHandle();
+	output->begin();
+}
+
+bool BambuLights::isAnimating() {
+  if (fade.isActive()) {
+    return true;
+  }
+
+  if (black || brightWhite) {
+    return false;
+  }
+
+  if (*currentPattern == pulse) {
+    return true;
+  }
+
+  Effect* effect = getEffect(*currentPattern);
+  return effect && effect->isAnimated();
+}
+
+void BambuLights::wake() {
+  if (!changeMicros) {
+    changeMicros = micros();
+  }
+  if (task) {
+    xTaskNotifyGive(task);
+  }
+}
+
+void BambuLights::waitForNextFrame() {
+  const TickType_t frameTicks = pdMS_TO_TICKS(FRAME_MS);
+
+  if (isAnimating()) {
+    if (!animating) {
+      // Start a new cadence
+      lastFrameTick = xTaskGetTickCount();
+      animating = true;
+    } else {
+      TickType_t sinceLastFrame = xTaskGetTickCount() - lastFrameTick;
+      if (sinceLastFrame > frameTicks) {
+        // Missed the deadline. Don't try to catch up, just restart the cadence from now
+        lateFrames++;
+        droppedFrames += sinceLastFrame / frameTicks - 1;
+        lastFrameTick += sinceLastFrame;
+      }
+    }
+
+    // Sleep until the next frame is due, unless woken for a change first. That gets drawn
+    // straight away, and the frame after it is still due when it was.
+    TickType_t sinceLastFrame = xTaskGetTickCount() - lastFrameTick;
+    if (sinceLastFrame < frameTicks) {
+      ulTaskNotifyTake(pdTRUE, frameTicks - sinceLastFrame);
+    }
+    if (xTaskGetTickCount() - lastFrameTick >= frameTicks) {
+      lastFrameTick += frameTicks;
+    }
+  } else {
+    // Nothing moving, so sleep until something changes. Still wake up now and then
+    // because some inputs (WiFi status, timeouts) are only ever polled.
+    animating = false;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(IDLE_POLL_MS));
+  }
 }
 
 void BambuLights::loop() {
+  uint32_t startMicros = micros();
+  if (lastLoopMicros) {
+    loopPeriods.add(startMicros - lastLoopMicros);
+  }
+  lastLoopMicros = startMicros;
+
+  applyUpdates();
+
+  // Anything that changes after this gets picked up by the next frame
+  uint32_t changedMicros = changeMicros;
+  changeMicros = 0;
+
+  // The fade is worked out once per frame, however many segments it gets drawn in
+  bool fading = fade.isActive();
+  CHSV fadeColor;
+  if (fading) {
+    fadeColor = fade.current(millis());
+#ifdef DEBUG_FADE
+    Serial.print("Blended color ");printCHSV(fadeColor);Serial.println("");
+#endif
+  }
+
+  // Segments only apply when the lights are reactive, white mode and off are the whole strip
+  Span spans[Effect::MAX_SEGMENTS];
+  uint8_t numSpans = getSpans(spans, black || brightWhite);
+
+  for (uint8_t i=0; i < numSpans; i++) {
+    frame.setWindow(spans[i].start, spans[i].length);
+    switch (spans[i].mode) {
+      case segmentWhite:
+        frame.fill(hsvToRgb(255, 0, 255));
+        break;
+      case segmentOff:
+        frame.fill(RgbColor(0));
+        break;
+      default:
+        if (fading) {
+          fill(fadeColor.h, fadeColor.s, fadeColor.v);
+        } else {
+          renderPattern(i);
+        }
+        break;
+    }
+  }
+  frame.clearWindow();
+  renderTimes.add(micros() - startMicros);
+
+  if (show() && changedMicros) {
+    changeLatencies.add(micros() - changedMicros);
+  }
+
+  uint32_t loopMicros = micros() - startMicros;
+  if (loopMicros > maxLoopMicros) {
+    maxLoopMicros = loopMicros;
+  }
+}
+
+void BambuLights::renderPattern(uint8_t segment) {
   //   enum patterns { dark, constant, rainbow, pulse, breath, num_patterns };
   uint8_t current_pattern = *currentPattern;
 
@@ -313,112 +679,143 @@ void BambuLights::loop() {
     fill(255, 0, 255);
   } else {
     uint16_t val;
+    Effect* effect;
     switch (current_pattern) {
+      case constant:
+        val = *currentValue;
+        val = val * brightness / 255;
+        fill(*currentHue, *currentSaturation, val);
+        break;
       case pulse:
         val = getPulseBrightness();
+        fill(*currentHue, *currentSaturation, val);
         break;
       default:
-        val = *currentValue;
-        val = val * brightness / 255;
+        effect = getEffect(current_pattern);
+        if (effect != currentEffect) {
+          currentEffect = effect;
+          if (effect) {
+            effect->reset();
+          }
+        }
+        if (effect) {
+          EffectParams params;
+          params.hue = *currentHue;
+          params.sat = *currentSaturation;
+          params.val = (*currentValue * brightness) / 255;
+          params.perMin = *currentPulsePerMin;
+          params.elapsedMs = millis() - pulseOffset;
+          params.progress = printProgress;
+          params.segment = segment;
+          effect->render(frame, params);
+        }
         break;
     }
-    fill(*currentHue, *currentSaturation, val);
   }
-  show();
 }
 
-#ifdef DEBUG_FADE
-void printCHSV(const CHSV& color) {
-  Serial.print("{h=");Serial.print(color.h);
-  Serial.print(",s=");Serial.print(color.s);
-  Serial.print(",v=");Serial.print(color.v);
-  Serial.print("}");
-}
-#endif
+static byte valueMin = 5;
 
-void BambuLights::crossFade(const CHSV& oldColor, const CHSV& newColor) {
-#ifdef DEBUG_FADE
-  Serial.print("Blending from ");printCHSV(oldColor);Serial.print(" to ");printCHSV(newColor);Serial.println("");
-#endif
-  TickType_t xLastWakeTime = xTaskGetTickCount();
-  const TickType_t xFrequency = 2 / portTICK_PERIOD_MS; // So we will take approximately 0.75s to do the whole blend
+void BambuLights::buildPulseTable(byte value, byte brightness) {
+  // https://sean.voisen.org/blog/2011/10/breathing-led-with-arduino/
+  float delta = (value - valueMin) / 2.35040238;  // 2.35040238 = e - 0.36787944
 
-  CHSV blendedColor;
-  for (int i=0; i < 255; i++) {
-    blendedColor = ::blend(oldColor, newColor, i, SHORTEST_HUES);
-#ifdef DEBUG_FADE
-    Serial.print("Blended color ");printCHSV(blendedColor);Serial.println("");
-#endif
-    fill(blendedColor.h, blendedColor.s, blendedColor.v);
-    show();
-    vTaskDelayUntil(&xLastWakeTime, xFrequency);
+  for (int i=0; i < PULSE_TABLE_SIZE; i++) {
+    float val = valueMin + (exp(cos(2 * M_PI * i / PULSE_TABLE_SIZE)) - 0.36787944f) * delta;
+    val = val * value / 256;
+    val = val * brightness / 255;
+    pulseTable[i] = val;
   }
-}
 
-static byte valueMin = 5;
+  pulseTableValue = value;
+  pulseTableBrightness = brightness;
+}
 
 byte BambuLights::getPulseBrightness() {
-  // https://sean.voisen.org/blog/2011/10/breathing-led-with-arduino/
-  float delta = (currentValue->value - valueMin) / 2.35040238;  // 2.35040238 = e - 0.36787944
+  byte value = currentValue->value;
+  byte pulsePerMin = currentPulsePerMin->value;
+
+  if (value != pulseTableValue || brightness != pulseTableBrightness) {
+    buildPulseTable(value, brightness);
+  }
+
+  if (pulsePerMin != pulseStepPerMin) {
+    // One full cycle is 2^32 of phase, so the phase wraps around by itself
+    pulseStep = (uint32_t)(((uint64_t)pulsePerMin << 32) / 60000);
+    pulseStepPerMin = pulsePerMin;
+  }
+
+  uint32_t phase = (uint32_t)(millis() - pulseOffset) * pulseStep;
 
-  float pulse_length_millis = (60.0f * 1000) / currentPulsePerMin->value;
-  float val = valueMin + (exp(cos(2 * M_PI * (millis() - pulseOffset) / pulse_length_millis)) - 0.36787944f) * delta;
-  val = val * currentValue->value / 256;
-  val = val * brightness / 255;
+  // Top byte indexes the table, the next byte interpolates towards the next entry
+  uint8_t index = phase >> 24;
+  uint8_t frac = phase >> 16;
+  int from = pulseTable[index];
+  int to = pulseTable[(uint8_t)(index + 1)];
 
-  return val;
+  return from + (((to - from) * frac) >> 8);
 }
 
 void BambuLights::fill(uint8_t hue, uint8_t sat, uint8_t val) {
-  static int oldHue = -1;
-  static int oldSat = -1;
-  static int oldVal = -1;
-  static byte oldCount = -1;
-  static byte oldLedType = -1;
-
-  if (hue != oldHue || sat != oldSat || val != oldVal || oldCount != getNumLEDs() || oldLedType != getLedType()) {
-    oldHue = hue;
-    oldSat = sat;
-    oldVal = val;
 #ifdef DEBUG_COLORS
-    Serial.print("Filling with ");
-    Serial.print("{h=");Serial.print(hue);
-    Serial.print(",s=");Serial.print(sat);
-    Serial.print(",v=");Serial.print(val);
-    Serial.print("}");
-    Serial.println("");
+  Serial.print("Filling with ");
+  Serial.print("{h=");Serial.print(hue);
+  Serial.print(",s=");Serial.print(sat);
+  Serial.print(",v=");Serial.print(val);
+  Serial.print("}");
+  Serial.println("");
 #endif
-    RgbColor color = HsbColor((byte)(hue)/256.0, (byte)(sat)/256.0, val/256.0);
-    // color = colorGamma.Correct(color);
-    if (getLedType() == 1)  { // RGB not GRB
-      uint8_t oldRed = color.R;
-      color.R = color.G;
-      color.G = oldRed;
-    }
-
-    for (uint8_t digit=0; digit < pixels->PixelCount(); digit++) {
-      pixels->SetPixelColor(digit, color);
-    }
-  }
+  frame.fill(hsvToRgb(hue, sat, val));
+  currentEffect = 0;  // Whatever effect was drawing will need to start over
 }
 
 void BambuLights::clear() {
   fill(0, 0, 0);
 }
 
-void BambuLights::show() {
-  pixels->Show();
+bool BambuLights::show() {
+  output->setMoving(isAnimating());
+  if (output->isDithering()) {
+    frame.markDirty();
+  }
+
+  if (frame.isDirty()) {
+    uint32_t startMicros = micros();
+    output->write(frame);
+    frame.clearDirty();
+
+    output->show();
+    showTimes.add(micros() - startMicros);
+    framesShown++;
+
+    return true;
+  }
+
+  return false;
 }
 
-void BambuLights::setPixelColor(uint8_t digit, uint8_t hue, uint8_t sat, uint8_t val) {
-    RgbColor color = HsbColor((byte)(hue)/256.0, (byte)(sat)/256.0, val/256.0);
-    if (getLedType() == 1)  { // RGB not GRB
-      uint8_t oldRed = color.R;
-      color.R = color.G;
-      color.G = oldRed;
-    }
-    pixels->SetPixelColor(digit, colorGamma.Correct(color));
+void BambuLights::setPixelColor(uint16_t digit, uint8_t hue, uint8_t sat, uint8_t val) {
+    frame.setPixel(digit, hsvToRgb(hue, sat, val));
+}
+
+Effect* BambuLights::getEffect(uint8_t pattern) {
+  static RainbowEffect rainbowEffect;
+  static ChaseEffect chaseEffect;
+  static CometEffect cometEffect;
+  static SparkleEffect sparkleEffect;
+  static GradientEffect gradientEffect;
+  static ProgressEffect progressEffect;
+
+  switch (pattern) {
+    case rainbow: return &rainbowEffect;
+    case chase: return &chaseEffect;
+    case comet: return &cometEffect;
+    case sparkle: return &sparkleEffect;
+    case gradient: return &gradientEffect;
+    case progress: return &progressEffect;
+    default: return 0;
+  }
 }
 
 const String BambuLights::patterns_str[BambuLights::num_patterns] = 
-  { "Constant", "Pulse" };
+  { "Constant", "Pulse", "Rainbow", "Chase", "Comet", "Sparkle", "Gradient", "Progress" };
@@ -5,17 +5,28 @@
 #include <ConfigItem.h>
 #include <NeoPixelBus.h>
 #include <FastLED.h>
+#include "Fade.h"
+#include "FrameBuffer.h"
+#include "Effects.h"
+#include "LedOutput.h"
+#include "LatencyHistogram.h"
 
 class BambuLights {
 public:
   BambuLights(int pin);
 
-  enum Patterns { constant, pulse, num_patterns };
+  enum Patterns { constant, pulse, rainbow, chase, comet, sparkle, gradient, progress, num_patterns };
   enum State { noWiFi, noPrinter, printer, printing, no_lights, white, error, warning, finished };
+  enum SegmentMode { segmentReactive, segmentWhite, segmentOff };
+
+  static const int MAX_LEDS = 1024;
+  static const uint8_t NUM_SEGMENTS = 3;
 
   const static String patterns_str[num_patterns];
 
   static CompositeConfigItem& getAllConfig();
+  // Brings settings saved by older firmware up to date, after they have been read. Returns true if anything changed.
+  static bool migrateConfig();
   static CompositeConfigItem& getNoWiFiConfig();
   static CompositeConfigItem& getNoPrinterConnectedConfig();
   static CompositeConfigItem& getPrinterConnectedConfig();
@@ -23,28 +34,104 @@ public:
   static CompositeConfigItem& getWarningConfig();
   static CompositeConfigItem& getErrorConfig();
   static CompositeConfigItem& getFinishedConfig();
+  static CompositeConfigItem& getSegment1Config();
+  static CompositeConfigItem& getSegment2Config();
+  static CompositeConfigItem& getSegment3Config();
   static ByteConfigItem& getIdleTimeout() { static ByteConfigItem timeout("timeout", 5); return timeout; }
   static ByteConfigItem& getLightMode() { static ByteConfigItem light_mode("light_mode", 1); return light_mode; } /* 0 = white, 1 = reactive */
   static BooleanConfigItem& getLightState() { static BooleanConfigItem light_state("light_state", 1); return light_state; } /* true == on, false == off */
   static BooleanConfigItem& getChamberSync() { static BooleanConfigItem chamber_sync("chamber_sync", 1); return chamber_sync; }
-  static ByteConfigItem& getLedType() { static ByteConfigItem led_type("led_type", 0); return led_type; } /* 0 = GRB, 1 = RGB */
-  static ByteConfigItem& getNumLEDs() { static ByteConfigItem num_leds("num_leds", 36); return num_leds; }
+  static ByteConfigItem& getLedType() { static ByteConfigItem led_type("led_type", 0); return led_type; } /* A LedOutput::Type: 0 = GRB, 1 = RGB, 2 = GRBW, 3 = RGBW */
+  static IntConfigItem& getNumLEDs() { static IntConfigItem led_count("led_count", 36); return led_count; }
+  /* Where the count was kept while it was a byte, 0 once it has been copied to led_count */
+  static ByteConfigItem& getLegacyNumLEDs() { static ByteConfigItem num_leds("num_leds", 36); return num_leds; }
+  static IntConfigItem& getFadeTime() { static IntConfigItem fade_time("fade_time", 500); return fade_time; } /* ms to fade between states */
+  static IntConfigItem& getMaxLEDs() { static IntConfigItem max_leds("max_leds", 0); return max_leds; } /* LEDs to reserve room for at boot, 0 = num_leds */
+  static ByteConfigItem& getGamma() { static ByteConfigItem gamma("gamma", 22); return gamma; } /* In tenths, 10 = off */
+  static ByteConfigItem& getRedBalance() { static ByteConfigItem wb_red("wb_red", 255); return wb_red; }
+  static ByteConfigItem& getGreenBalance() { static ByteConfigItem wb_green("wb_green", 255); return wb_green; }
+  static ByteConfigItem& getBlueBalance() { static ByteConfigItem wb_blue("wb_blue", 255); return wb_blue; }
+  static BooleanConfigItem& getDithering() { static BooleanConfigItem dithering("dithering", true); return dithering; }
+  static IntConfigItem& getMaxMilliamps() { static IntConfigItem max_ma("max_ma", 0); return max_ma; } /* Power budget for the strip, 0 = no limit */
+  static StringConfigItem& getLedPins() { static StringConfigItem led_pins("led_pins", 31, ""); return led_pins; } /* e.g. "4,5,6", empty = the default pin */
 
   void begin();
   void loop();
-  void updatePixelCount();
+
+  // Blocks the calling (LED) task until the next frame is due. While something is
+  // animating that is every FRAME_MS, otherwise it is until wake() is called.
+  void waitForNextFrame();
+  void wake();
+  bool isAnimating();
+
+  // For the config callbacks, which run on the web server's task. The output belongs to the
+  // LED task, so these only note what changed and wake it, and loop() applies it.
+  void updatePixelCount() { requestUpdate(UPDATE_PIXEL_COUNT); }
+  void updateCorrection() { requestUpdate(UPDATE_CORRECTION); }
+  void updatePowerLimit() { requestUpdate(UPDATE_POWER_LIMIT); }
 
   void setState(State state);
   void setBrightness(byte brightness) { this->brightness = brightness; }
+  void setProgress(uint8_t percent) { printProgress = percent; }
+
+  // Worst case time spent in one call to loop(), i.e. the longest the LED task is kept busy
+  uint32_t getMaxLoopMicros() const { return maxLoopMicros; }
+  uint16_t getLastFadeFrames() const { return fade.getLastFrames(); }
+  uint32_t getLastFadeMillis() const { return fade.getLastDurationMs(); }
+  uint32_t getFramesShown() const { return framesShown; }
+  uint32_t getLateFrames() const { return lateFrames; }
+  uint32_t getDroppedFrames() const { return droppedFrames; }
+  uint8_t getNumOutputs() const { return output->getNumOutputs(); }
+  uint16_t getLongestOutput() const { return output->getLongestOutput(); }
+  uint32_t getExpectedFrameMicros() const { return output->getExpectedFrameMicros(); }
+  uint32_t getLiveFrameMicros() const { return output->getLiveFrameMicros(); }
+  uint16_t getLEDCapacity() const { return output->getCapacity(); }
+  uint32_t getEstimatedMilliamps() const { return output->getEstimatedMilliamps(); }
+  uint16_t getPowerScale() const { return output->getPowerScale(); }
+
+  // Time spent drawing a frame, and then getting it out to the strip
+  const LatencyHistogram& getRenderTimes() const { return renderTimes; }
+  const LatencyHistogram& getShowTimes() const { return showTimes; }
+  // Time from one loop() to the next
+  const LatencyHistogram& getLoopPeriods() const { return loopPeriods; }
+  // Time from a state change or wake() to the first frame that shows it
+  const LatencyHistogram& getChangeLatencies() const { return changeLatencies; }
+  uint32_t getLargestFreeBeforeResize() const { return largestFreeBeforeResize; }
+  uint32_t getLargestFreeAfterResize() const { return largestFreeAfterResize; }
 
 private:
+  // A run of LEDs that are all drawn the same way
+  struct Span {
+    uint16_t start;
+    uint16_t length;
+    uint8_t mode;
+  };
+
+  struct Segment {
+    IntConfigItem *start;
+    IntConfigItem *length;
+    ByteConfigItem *mode;
+  };
+
+  static_assert(2 * NUM_SEGMENTS + 1 <= Effect::MAX_SEGMENTS, "Segments can split the strip into more spans than effects can track");
+
+  static const uint32_t FRAME_MS = 16;
+  static const uint32_t IDLE_POLL_MS = 100;
+
+  // Bits of pendingUpdates
+  static const uint8_t UPDATE_PIXEL_COUNT = 0x01;
+  static const uint8_t UPDATE_CORRECTION = 0x02;
+  static const uint8_t UPDATE_POWER_LIMIT = 0x04;
+
   bool black = false;
   bool brightWhite = false;
   byte brightness = 255;
+  uint8_t printProgress = 0;
   int pin;
   
-  NeoPixelBus <NeoGrbFeature, Neo800KbpsMethod> *pixels;
-  NeoGamma<NeoGammaTableMethod> colorGamma;
+  LedOutput *output;
+  uint8_t outputType;
+  FrameBuffer frame;
 
   State currentState;
   CompositeConfigItem *currentConfig;
@@ -54,17 +141,59 @@ private:
   ByteConfigItem *currentSaturation;
   ByteConfigItem *currentPulsePerMin;
   long pulseOffset = 0;
+  Fade fade;
+  Effect *currentEffect = 0;
+  uint32_t maxLoopMicros = 0;
+
+  TaskHandle_t task = 0;
+  uint8_t pendingUpdates = 0;
+  bool animating = false;
+  TickType_t lastFrameTick = 0;
+  uint32_t framesShown = 0;
+  uint32_t lateFrames = 0;
+  uint32_t droppedFrames = 0;
+  uint32_t largestFreeBeforeResize = 0;
+  uint32_t largestFreeAfterResize = 0;
+
+  LatencyHistogram renderTimes;
+  LatencyHistogram showTimes;
+  LatencyHistogram loopPeriods;
+  LatencyHistogram changeLatencies;
+  uint32_t lastLoopMicros = 0;
+  volatile uint32_t changeMicros = 0;
+
+  // One breathing cycle, rebuilt whenever the value or brightness it was built for changes
+  static const int PULSE_TABLE_SIZE = 256;
+  byte pulseTable[PULSE_TABLE_SIZE];
+  int pulseTableValue = -1;
+  int pulseTableBrightness = -1;
+  uint32_t pulseStep = 0;     // Phase advance per ms
+  int pulseStepPerMin = -1;
+
+  Segment segments[NUM_SEGMENTS];
 
+  static uint16_t getLEDCount();
+  static uint16_t getReservedLEDCount();
+  void createOutput(uint16_t capacity);
+  void requestUpdate(uint8_t update);
+  void applyUpdates();
+  void applyPixelCount();
+  void applyCorrection();
+  void applyPowerLimit();
   void setCurrentConfig(CompositeConfigItem& config);
+  void setSegmentConfig(uint8_t segment, CompositeConfigItem& config);
+  uint8_t getSpans(Span *spans, bool wholeStrip);
+  void renderPattern(uint8_t segment);
 
   // Pattern methods
   byte getPulseBrightness();
+  void buildPulseTable(byte value, byte brightness);
 
   void fill(uint8_t hue, uint8_t val, uint8_t sat);
-  void show();
+  bool show();
   void clear();
-  void setPixelColor(uint8_t digit, uint8_t hue, uint8_t val, uint8_t sat);
-  void crossFade(const CHSV& oldColor, const CHSV& newColor);
+  void setPixelColor(uint16_t digit, uint8_t hue, uint8_t sat, uint8_t val);
+  static Effect* getEffect(uint8_t pattern);
 };
 
 #endif // BAMBULIGHTS_H
@@ -0,0 +1,25 @@
+#include "ColorCorrection.h"
+#include <math.h>
+
+ColorCorrection::ColorCorrection() {
+  build(10, 255, 255, 255);
+}
+
+void ColorCorrection::build(uint8_t gamma, uint8_t red, uint8_t green, uint8_t blue) {
+  if (gamma < 10) {
+    gamma = 10;
+  }
+
+  // Only done when the settings change, so the floats don't matter even on the C3
+  buildChannel(table[0], gamma / 10.0f, red);
+  buildChannel(table[1], gamma / 10.0f, green);
+  buildChannel(table[2], gamma / 10.0f, blue);
+}
+
+void ColorCorrection::buildChannel(uint16_t *table, float gamma, uint8_t balance) {
+  float scale = 255.0f * 256.0f * balance / 255.0f;
+
+  for (int i=0; i < 256; i++) {
+    table[i] = (uint16_t)(powf(i / 255.0f, gamma) * scale + 0.5f);
+  }
+}
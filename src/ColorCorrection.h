@@ -0,0 +1,50 @@
+#ifndef COLORCORRECTION_H
+#define COLORCORRECTION_H
+
+#include <stdint.h>
+#include <NeoPixelBus.h>
+
+/*
+ * Per-channel gamma and white balance, applied to each pixel on its way out
+ * to the strip. The tables hold 8.8 fixed point values so that the fraction
+ * lost when rounding to 8 bits can be dithered over successive frames,
+ * which keeps dim colors and slow fades from stepping visibly.
+ */
+class ColorCorrection {
+public:
+  ColorCorrection();
+
+  // gamma is in tenths, e.g. 22 for 2.2. 10 is linear.
+  void build(uint8_t gamma, uint8_t red, uint8_t green, uint8_t blue);
+
+  // threshold is the fraction (out of 256) at which a channel rounds up. 128 rounds to nearest.
+  // scale is out of 256 and is applied before rounding, so it gets dithered too.
+  inline RgbColor apply(const RgbColor& color, uint8_t threshold, uint16_t scale = 256) const {
+    return RgbColor(
+      (scaled(0, color.R, scale) + threshold) >> 8,
+      (scaled(1, color.G, scale) + threshold) >> 8,
+      (scaled(2, color.B, scale) + threshold) >> 8
+    );
+  }
+
+  // True if any channel of the corrected color falls between two output levels
+  inline bool isFractional(const RgbColor& color, uint16_t scale = 256) const {
+    return ((scaled(0, color.R, scale) | scaled(1, color.G, scale) | scaled(2, color.B, scale)) & 0xff) != 0;
+  }
+
+  // All three corrected channels added up, in 8.8 fixed point
+  inline uint32_t sum(const RgbColor& color) const {
+    return table[0][color.R] + table[1][color.G] + table[2][color.B];
+  }
+
+private:
+  uint16_t table[3][256];
+
+  inline uint16_t scaled(uint8_t channel, uint8_t value, uint16_t scale) const {
+    return (uint32_t(table[channel][value]) * scale) >> 8;
+  }
+
+  static void buildChannel(uint16_t *table, float gamma, uint8_t balance);
+};
+
+#endif // COLORCORRECTION_H
@@ -0,0 +1,54 @@
+#include "CountingAllocator.h"
+#include <stdlib.h>
+
+// Keeps the block that is handed out aligned the same as malloc() would
+static const size_t HEADER_SIZE = sizeof(max_align_t);
+
+void* CountingAllocator::allocate(size_t size) {
+  uint8_t *block = (uint8_t*)malloc(size + HEADER_SIZE);
+  if (!block) {
+    return 0;
+  }
+
+  *(size_t*)block = size;
+  allocations++;
+  currentBytes += size;
+  if (currentBytes > peakBytes) {
+    peakBytes = currentBytes;
+  }
+
+  return block + HEADER_SIZE;
+}
+
+void CountingAllocator::deallocate(void* ptr) {
+  if (!ptr) {
+    return;
+  }
+
+  uint8_t *block = (uint8_t*)ptr - HEADER_SIZE;
+  currentBytes -= *(size_t*)block;
+  free(block);
+}
+
+void* CountingAllocator::reallocate(void* ptr, size_t newSize) {
+  if (!ptr) {
+    return allocate(newSize);
+  }
+
+  uint8_t *block = (uint8_t*)ptr - HEADER_SIZE;
+  size_t oldSize = *(size_t*)block;
+
+  block = (uint8_t*)realloc(block, newSize + HEADER_SIZE);
+  if (!block) {
+    return 0;
+  }
+
+  *(size_t*)block = newSize;
+  allocations++;
+  currentBytes = currentBytes - oldSize + newSize;
+  if (currentBytes > peakBytes) {
+    peakBytes = currentBytes;
+  }
+
+  return block + HEADER_SIZE;
+}
@@ -0,0 +1,32 @@
+#ifndef COUNTINGALLOCATOR_H
+#define COUNTINGALLOCATOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <ArduinoJson.h>
+
+/*
+ * A JsonDocument allocator that counts what the document asks for, so we
+ * can see how much memory parsing a message really takes. Each block
+ * carries its size in a small header so that frees can be counted too.
+ */
+class CountingAllocator : public ArduinoJson::Allocator {
+public:
+  virtual void* allocate(size_t size);
+  virtual void deallocate(void* ptr);
+  virtual void* reallocate(void* ptr, size_t newSize);
+
+  // Starts counting again, e.g. at the start of each message
+  void reset() { allocations = 0; peakBytes = currentBytes; }
+
+  uint32_t getAllocations() const { return allocations; }
+  size_t getCurrentBytes() const { return currentBytes; }
+  size_t getPeakBytes() const { return peakBytes; }
+
+private:
+  uint32_t allocations = 0;
+  size_t currentBytes = 0;
+  size_t peakBytes = 0;
+};
+
+#endif // COUNTINGALLOCATOR_H
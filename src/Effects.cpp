@@ -0,0 +1,161 @@
+#include "Effects.h"
+
+uint32_t Effect::getPhase(const EffectParams& params) {
+  uint32_t step = (uint32_t)(((uint64_t)params.perMin << 32) / 60000);
+  return params.elapsedMs * step;
+}
+
+uint16_t Effect::getPosition(const EffectParams& params, uint16_t count) {
+  return ((getPhase(params) >> 16) * count) >> 16;
+}
+
+void RainbowEffect::render(FrameBuffer& frame, const EffectParams& params) {
+  uint16_t count = frame.getCount();
+  if (count == 0) {
+    return;
+  }
+
+  // Hue in 8.8 fixed point so long strips still get a smooth spread
+  uint16_t hue = (params.hue << 8) + (getPhase(params) >> 16);
+  uint16_t hueStep = 65536 / count;
+
+  for (uint16_t i=0; i < count; i++) {
+    frame.setPixel(i, hsvToRgb(hue >> 8, params.sat, params.val));
+    hue += hueStep;
+  }
+}
+
+void ChaseEffect::render(FrameBuffer& frame, const EffectParams& params) {
+  RgbColor color = hsvToRgb(params.hue, params.sat, params.val);
+  RgbColor black(0);
+  uint8_t lit = getPosition(params, frame.getCount()) % 3;
+
+  for (uint16_t i=0; i < frame.getCount(); i++) {
+    frame.setPixel(i, lit == 0 ? color : black);
+    lit = lit == 0 ? 2 : lit - 1;
+  }
+}
+
+void CometEffect::render(FrameBuffer& frame, const EffectParams& params) {
+  uint16_t count = frame.getCount();
+  if (count == 0) {
+    return;
+  }
+
+  uint16_t head = getPosition(params, count);
+  uint16_t tail = count / 4;
+  if (tail == 0) {
+    tail = 1;
+  }
+
+  for (uint16_t i=0; i < count; i++) {
+    // Distance behind the head, wrapping round the end of the strip
+    uint16_t behind = i <= head ? head - i : head + count - i;
+    if (behind < tail) {
+      uint32_t remaining = tail - behind;
+      uint8_t val = (params.val * remaining * remaining) / ((uint32_t)tail * tail);
+      frame.setPixel(i, hsvToRgb(params.hue, params.sat, val));
+    } else {
+      frame.setPixel(i, RgbColor(0));
+    }
+  }
+}
+
+uint32_t SparkleEffect::random() {
+  // xorshift32
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+void SparkleEffect::render(FrameBuffer& frame, const EffectParams& params) {
+  uint16_t count = frame.getCount();
+  if (count == 0) {
+    return;
+  }
+
+  uint8_t segment = params.segment % MAX_SEGMENTS;
+  if (params.elapsedMs < lastMs[segment]) {
+    // Effect restarted
+    lastMs[segment] = params.elapsedMs;
+    sparkleAccumulator[segment] = 0;
+  }
+
+  uint32_t elapsed = params.elapsedMs - lastMs[segment];
+  if (elapsed == 0) {
+    return;
+  }
+  lastMs[segment] = params.elapsedMs;
+
+  // Decay what's already lit, about 1/8 every 16ms
+  uint32_t keep = elapsed >= 128 ? 0 : 256 - elapsed * 2;
+  for (uint16_t i=0; i < count; i++) {
+    const RgbColor& color = frame.getPixel(i);
+    frame.setPixel(i, RgbColor((color.R * keep) >> 8, (color.G * keep) >> 8, (color.B * keep) >> 8));
+  }
+
+  // perMin sparkles per pixel per minute
+  RgbColor sparkle = hsvToRgb(params.hue, params.sat, params.val);
+  sparkleAccumulator[segment] += (uint32_t)count * params.perMin * elapsed;
+  while (sparkleAccumulator[segment] >= 60000) {
+    sparkleAccumulator[segment] -= 60000;
+    frame.setPixel(random() % count, sparkle);
+  }
+}
+
+void GradientEffect::render(FrameBuffer& frame, const EffectParams& params) {
+  uint16_t count = frame.getCount();
+  if (count == 0) {
+    return;
+  }
+
+  uint16_t hue = params.hue << 8;
+  uint16_t hueStep = (85 << 8) / count;
+
+  for (uint16_t i=0; i < count; i++) {
+    frame.setPixel(i, hsvToRgb(hue >> 8, params.sat, params.val));
+    hue += hueStep;
+  }
+}
+
+void ProgressEffect::reset() {
+  for (uint8_t i=0; i < MAX_SEGMENTS; i++) {
+    rendered[i].count = 0;
+  }
+}
+
+void ProgressEffect::render(FrameBuffer& frame, const EffectParams& params) {
+  uint16_t start = frame.getWindowStart();
+  uint16_t count = frame.getCount();
+  uint8_t progress = params.progress > 100 ? 100 : params.progress;
+
+  // A segment can move along the strip without changing length, and then the bar has to be drawn where it went
+  Rendered& last = rendered[params.segment % MAX_SEGMENTS];
+  if (start == last.start && count == last.count && progress == last.progress &&
+      params.hue == last.hue && params.sat == last.sat && params.val == last.val) {
+    return;
+  }
+  last.start = start;
+  last.count = count;
+  last.progress = progress;
+  last.hue = params.hue;
+  last.sat = params.sat;
+  last.val = params.val;
+
+  // Lit length in 8.8 fixed point pixels
+  uint32_t lit = ((uint32_t)count * progress * 256) / 100;
+  uint16_t full = lit >> 8;
+  uint8_t edge = lit & 0xff;
+
+  RgbColor color = hsvToRgb(params.hue, params.sat, params.val);
+  for (uint16_t i=0; i < count; i++) {
+    if (i < full) {
+      frame.setPixel(i, color);
+    } else if (i == full) {
+      frame.setPixel(i, hsvToRgb(params.hue, params.sat, (params.val * edge) >> 8));
+    } else {
+      frame.setPixel(i, RgbColor(0));
+    }
+  }
+}
@@ -0,0 +1,103 @@
+#ifndef EFFECTS_H
+#define EFFECTS_H
+
+#include <stdint.h>
+#include "FrameBuffer.h"
+
+struct EffectParams {
+  uint8_t hue;
+  uint8_t sat;
+  uint8_t val;          // Already scaled by the overall brightness
+  uint8_t perMin;       // Speed, in cycles per minute
+  uint32_t elapsedMs;   // Time since the effect started
+  uint8_t progress;     // Print progress, 0 - 100
+  uint8_t segment;      // Which part of the strip is being drawn, for effects that keep state
+};
+
+/*
+ * An effect renders a whole frame into the frame buffer. Effects only use
+ * integer math and only write pixels that change, so the frame buffer can
+ * work out what actually needs to be sent to the strip.
+ */
+class Effect {
+public:
+  static const uint8_t MAX_SEGMENTS = 8;
+
+  virtual ~Effect() {}
+
+  virtual void render(FrameBuffer& frame, const EffectParams& params) = 0;
+
+  // False if the output only depends on the params, not on the time
+  virtual bool isAnimated() const { return true; }
+
+  // Called when the effect is (re)started on a frame buffer someone else may have drawn on
+  virtual void reset() {}
+
+protected:
+  // Position in the current cycle, one full cycle is 2^32
+  static uint32_t getPhase(const EffectParams& params);
+
+  // Position in the current cycle scaled to 0 - (count-1)
+  static uint16_t getPosition(const EffectParams& params, uint16_t count);
+};
+
+// The whole color wheel spread along the strip, rotating
+class RainbowEffect : public Effect {
+public:
+  virtual void render(FrameBuffer& frame, const EffectParams& params);
+};
+
+// Theater chase - every third pixel lit, marching along the strip
+class ChaseEffect : public Effect {
+public:
+  virtual void render(FrameBuffer& frame, const EffectParams& params);
+};
+
+// A bright head with a fading tail running along the strip
+class CometEffect : public Effect {
+public:
+  virtual void render(FrameBuffer& frame, const EffectParams& params);
+};
+
+// Random pixels flash up and decay
+class SparkleEffect : public Effect {
+public:
+  virtual void render(FrameBuffer& frame, const EffectParams& params);
+
+private:
+  uint32_t random();
+
+  uint32_t lastMs[MAX_SEGMENTS] = {};
+  uint32_t sparkleAccumulator[MAX_SEGMENTS] = {};
+  uint32_t seed = 0x2545F491;
+};
+
+// A third of the color wheel, starting at the configured hue, spread along the strip
+class GradientEffect : public Effect {
+public:
+  virtual void render(FrameBuffer& frame, const EffectParams& params);
+  virtual bool isAnimated() const { return false; }
+};
+
+// Lights the fraction of the strip given by the print progress, with an anti-aliased leading edge
+class ProgressEffect : public Effect {
+public:
+  virtual void render(FrameBuffer& frame, const EffectParams& params);
+  virtual bool isAnimated() const { return false; }
+  virtual void reset();
+
+private:
+  // What was last rendered, and where, so nothing is redone until the progress actually changes
+  struct Rendered {
+    uint16_t start;
+    uint16_t count;
+    uint8_t progress;
+    uint8_t hue;
+    uint8_t sat;
+    uint8_t val;
+  };
+
+  Rendered rendered[MAX_SEGMENTS] = {};
+};
+
+#endif // EFFECTS_H
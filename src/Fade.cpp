@@ -0,0 +1,42 @@
+#include "Fade.h"
+
+void Fade::start(const CHSV& from, const CHSV& to, uint32_t nowMs, uint32_t durationMs) {
+  this->from = from;
+  this->to = to;
+  this->startMs = nowMs;
+  this->durationMs = durationMs;
+  frames = 0;
+  active = true;
+}
+
+uint8_t Fade::getProgress(uint32_t nowMs) const {
+  if (!active) {
+    return 255;
+  }
+
+  uint32_t elapsed = nowMs - startMs;
+  if (elapsed >= durationMs) {
+    return 255;
+  }
+
+  // In 64 bits, so a fade of more than a few hours doesn't overflow
+  return ((uint64_t)elapsed * 255) / durationMs;
+}
+
+CHSV Fade::current(uint32_t nowMs) {
+  if (!active) {
+    return to;
+  }
+
+  frames++;
+
+  uint8_t progress = getProgress(nowMs);
+  if (progress == 255) {
+    active = false;
+    lastFrames = frames;
+    lastDurationMs = nowMs - startMs;
+    return to;
+  }
+
+  return ::blend(from, to, progress, SHORTEST_HUES);
+}
@@ -0,0 +1,41 @@
+#ifndef FADE_H
+#define FADE_H
+
+#include <stdint.h>
+#include <FastLED.h>
+
+/*
+ * A cross-fade between two colors that is advanced a frame at a time by the
+ * caller rather than run to completion in a loop.
+ */
+class Fade {
+public:
+  void start(const CHSV& from, const CHSV& to, uint32_t nowMs, uint32_t durationMs);
+  void stop() { active = false; }
+
+  // Color to show at nowMs. Ends the fade once the duration has elapsed.
+  CHSV current(uint32_t nowMs);
+
+  bool isActive() const { return active; }
+  const CHSV& getTarget() const { return to; }
+
+  // 0 - 255 progress through the fade
+  uint8_t getProgress(uint32_t nowMs) const;
+
+  // Timing of the last completed fade
+  uint16_t getLastFrames() const { return lastFrames; }
+  uint32_t getLastDurationMs() const { return lastDurationMs; }
+
+private:
+  CHSV from;
+  CHSV to;
+  uint32_t startMs = 0;
+  uint32_t durationMs = 0;
+  uint16_t frames = 0;
+  bool active = false;
+
+  uint16_t lastFrames = 0;
+  uint32_t lastDurationMs = 0;
+};
+
+#endif // FADE_H
@@ -0,0 +1,113 @@
+#include "FrameBuffer.h"
+#include <Arduino.h>
+#include <algorithm>
+
+/*
+ * Every channel is the exact floor of what the float conversion computes, so
+ * this produces identical output for all 2^24 inputs, but without touching the
+ * FPU (the C3 doesn't have one).
+ */
+RgbColor hsvToRgb(uint8_t hue, uint8_t sat, uint8_t val) {
+  uint8_t v = (uint16_t(val) * 255) >> 8;
+  if (sat == 0) {
+    return RgbColor(v, v, v);
+  }
+
+  uint16_t h6 = uint16_t(hue) * 6;  // Sector in the high byte, position within it in the low byte
+  uint8_t sector = h6 >> 8;
+  uint32_t f = h6 & 0xff;
+  uint32_t vs = uint32_t(val) * 255;
+
+  uint8_t p = (vs * (256 - sat)) >> 16;
+  uint8_t q = (vs * (65536 - sat * f)) >> 24;
+  uint8_t t = (vs * (65536 - sat * (256 - f))) >> 24;
+
+  switch (sector) {
+    case 0: return RgbColor(v, t, p);
+    case 1: return RgbColor(q, v, p);
+    case 2: return RgbColor(p, v, t);
+    case 3: return RgbColor(p, q, v);
+    case 4: return RgbColor(t, p, v);
+    default: return RgbColor(v, p, q);
+  }
+}
+
+FrameBuffer::FrameBuffer(uint16_t count, uint16_t capacity) : count(0), capacity(max(count, capacity)) {
+  pixels = new RgbColor[this->capacity];
+  resize(count);
+}
+
+FrameBuffer::~FrameBuffer() {
+  delete[] pixels;
+}
+
+void FrameBuffer::resize(uint16_t count) {
+  if (count > capacity) {
+    delete[] pixels;
+    capacity = count;
+    pixels = new RgbColor[capacity];
+  } else {
+    std::fill(pixels, pixels + capacity, RgbColor(0));
+  }
+  this->count = count;
+  uniform = true; // All black
+  dirtyStart = 0;
+  dirtyEnd = count;
+  clearWindow();
+}
+
+void FrameBuffer::setWindow(uint16_t start, uint16_t length) {
+  if (start > count) {
+    start = count;
+  }
+  if (length > count - start) {
+    length = count - start;
+  }
+
+  windowStart = start;
+  windowCount = length;
+}
+
+void FrameBuffer::markDirty(uint16_t start, uint16_t end) {
+  if (start < dirtyStart) {
+    dirtyStart = start;
+  }
+  if (end > dirtyEnd) {
+    dirtyEnd = end;
+  }
+}
+
+void FrameBuffer::setPixel(uint16_t index, const RgbColor& color) {
+  if (index >= windowCount) {
+    return;
+  }
+
+  index += windowStart;
+  if (pixels[index] == color) {
+    return;
+  }
+
+  pixels[index] = color;
+  uniform = false;
+  markDirty(index, index + 1);
+}
+
+void FrameBuffer::fill(const RgbColor& color) {
+  if (count == 0 || (uniform && pixels[0] == color)) {
+    return;
+  }
+
+  if (windowCount != count) {
+    // Only part of the strip, so it can't become uniform
+    for (uint16_t i=0; i < windowCount; i++) {
+      setPixel(i, color);
+    }
+    return;
+  }
+
+  for (uint16_t i=0; i < count; i++) {
+    pixels[i] = color;
+  }
+  uniform = true;
+  markDirty();
+}
@@ -0,0 +1,60 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <stdint.h>
+#include <NeoPixelBus.h>
+
+// Integer equivalent of RgbColor(HsbColor(hue/256.0, sat/256.0, val/256.0))
+RgbColor hsvToRgb(uint8_t hue, uint8_t sat, uint8_t val);
+
+/*
+ * One RGB value per LED, rendered into by the patterns/effects and then
+ * copied out to the strip. Only the range of pixels that actually changed
+ * since the last flush is marked dirty.
+ *
+ * Drawing can be restricted to a window (a segment of the strip), in which
+ * case getCount(), getPixel(), setPixel() and fill() are all relative to it.
+ *
+ * The buffer is allocated for a fixed capacity up front, and only
+ * reallocated if it has to grow past that.
+ */
+class FrameBuffer {
+public:
+  FrameBuffer(uint16_t count, uint16_t capacity = 0);
+  ~FrameBuffer();
+
+  void resize(uint16_t count);
+  uint16_t getCapacity() const { return capacity; }
+
+  void setWindow(uint16_t start, uint16_t length);
+  void clearWindow() { windowStart = 0; windowCount = count; }
+
+  uint16_t getCount() const { return windowCount; }
+  uint16_t getWindowStart() const { return windowStart; }
+  const RgbColor& getPixel(uint16_t index) const { return pixels[windowStart + index]; }
+  void setPixel(uint16_t index, const RgbColor& color);
+  void fill(const RgbColor& color);
+
+  bool isUniform() const { return uniform; }
+  bool isDirty() const { return dirtyStart < dirtyEnd; }
+  uint16_t getDirtyStart() const { return dirtyStart; }
+  uint16_t getDirtyEnd() const { return dirtyEnd; }
+  void markDirty() { markDirty(0, count); }
+  void clearDirty() { dirtyStart = count; dirtyEnd = 0; }
+
+private:
+  void markDirty(uint16_t start, uint16_t end);
+
+  RgbColor *pixels;
+  uint16_t count;
+  uint16_t capacity;
+  uint16_t windowStart;
+  uint16_t windowCount;
+  uint16_t dirtyStart;
+  uint16_t dirtyEnd;
+
+  // Set when the whole buffer is known to be one color, so repeated fills are free
+  bool uniform;
+};
+
+#endif // FRAMEBUFFER_H
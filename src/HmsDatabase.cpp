@@ -0,0 +1,82 @@
+#include "HmsDatabase.h"
+#include <string.h>
+#include "HmsDatabaseData.h"
+
+static_assert(HMS_DB_LONGEST_MESSAGE < HmsDatabase::MAX_MESSAGE, "HmsDatabase::MAX_MESSAGE is too small for the generated messages");
+
+// Must match hash_key() in .build_hms.py
+uint32_t HmsDatabase::hash(uint64_t code, uint32_t seed) {
+  uint64_t h = code ^ (seed * 0x9E3779B97F4A7C15ULL);
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  h *= 0xC4CEB93FE53E4F77ULL;
+  h ^= h >> 33;
+  return (uint32_t)h;
+}
+
+int HmsDatabase::find(uint64_t code) {
+  int16_t seed = HMS_DB_SEEDS[hash(code, 0) % HMS_DB_NUM_CODES];
+  int slot = seed < 0 ? -seed - 1 : hash(code, seed) % HMS_DB_NUM_CODES;
+
+  // Codes that aren't in the table still hash to some slot
+  return HMS_DB_CODES[slot] == code ? slot : -1;
+}
+
+bool HmsDatabase::contains(uint64_t code) {
+  return find(code) >= 0;
+}
+
+bool HmsDatabase::describe(uint64_t code, char *message, size_t size) {
+  if (size == 0) {
+    return find(code) >= 0;
+  }
+
+  int slot = find(code);
+  if (slot < 0) {
+    strncpy(message, "unknown", size);
+    message[size - 1] = 0;
+    return false;
+  }
+
+  uint16_t id = HMS_DB_MESSAGE_IDS[slot];
+  const uint8_t *text = HMS_DB_MESSAGE_TEXT + HMS_DB_MESSAGE_OFFSETS[id];
+  const uint8_t *end = HMS_DB_MESSAGE_TEXT + HMS_DB_MESSAGE_OFFSETS[id + 1];
+
+  // Words are one byte ids, or two with the top bit set, separated by single spaces
+  size_t length = 0;
+  while (text < end && length < size - 1) {
+    uint16_t word = *text++;
+    if (word & 0x80) {
+      word = ((word & 0x7F) << 8) | *text++;
+    }
+
+    if (length > 0) {
+      message[length++] = ' ';
+    }
+
+    size_t wordLength = HMS_DB_WORD_OFFSETS[word + 1] - HMS_DB_WORD_OFFSETS[word];
+    if (wordLength > size - 1 - length) {
+      wordLength = size - 1 - length;
+    }
+    memcpy(message + length, HMS_DB_WORDS + HMS_DB_WORD_OFFSETS[word], wordLength);
+    length += wordLength;
+  }
+  message[length] = 0;
+
+  return true;
+}
+
+size_t HmsDatabase::getCount() {
+  return HMS_DB_NUM_CODES;
+}
+
+size_t HmsDatabase::getFlashBytes() {
+  return sizeof(HMS_DB_SEEDS) + sizeof(HMS_DB_CODES) + sizeof(HMS_DB_MESSAGE_IDS)
+    + sizeof(HMS_DB_MESSAGE_OFFSETS) + sizeof(HMS_DB_MESSAGE_TEXT)
+    + sizeof(HMS_DB_WORD_OFFSETS) + sizeof(HMS_DB_WORDS);
+}
+
+const char *HmsDatabase::getVersion() {
+  return HMS_DB_VERSION;
+}
@@ -0,0 +1,36 @@
+#ifndef HMSDATABASE_H
+#define HMSDATABASE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Descriptions of the printer's HMS and print_error codes, from the table
+ * .build_hms.py generates out of docs/codes.json. The table lives in
+ * flash: codes are found with a minimal perfect hash and their message is
+ * decoded from a shared word dictionary into the caller's buffer, so a
+ * lookup costs no RAM beyond that buffer.
+ *
+ * HMS codes are keyed as (attr << 32) | code, print_error codes as is.
+ */
+class HmsDatabase {
+public:
+  // Big enough for the longest message
+  static const size_t MAX_MESSAGE = 384;
+
+  static bool contains(uint64_t code);
+
+  // Writes the description of code into message, truncated to fit. Returns
+  // false, with message set to "unknown", if the code isn't in the table
+  static bool describe(uint64_t code, char *message, size_t size);
+
+  static size_t getCount();
+  static size_t getFlashBytes();
+  static const char *getVersion();
+
+private:
+  static uint32_t hash(uint64_t code, uint32_t seed);
+  static int find(uint64_t code);
+};
+
+#endif // HMSDATABASE_H
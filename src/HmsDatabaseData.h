@@ -0,0 +1,1631 @@
+// Generated by .build_hms.py from docs/codes.json, do not edit.
+#ifndef HMS_DATABASE_DATA_H_
+#define HMS_DATABASE_DATA_H_
+
+#include <stdint.h>
+
+#define HMS_DB_VERSION "202405112230"
+#define HMS_DB_NUM_CODES 1036
+#define HMS_DB_NUM_MESSAGES 843
+#define HMS_DB_NUM_WORDS 1068
+#define HMS_DB_LONGEST_MESSAGE 324
+
+// Per bucket seed, or -(slot + 1) for buckets holding a single code
+static const int16_t HMS_DB_SEEDS[HMS_DB_NUM_CODES] = {
+    0, -1035, 0, 0, 1, 0, -1033, 3, -1030, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, -1029, 0, 2, -1024, 0, 1,
+    -1022, 0, -1020, 0, 1, -1017, -1016, -1008, 2, 0, -1005, 0,
+    0, 0, -1003, 1, -1002, 0, 0, 0, 0, 0, -998, -992,
+    0, 1, 0, 1, 1, 1, -991, -990, 2, 2, -987, 0,
+    0, 0, 0, 0, 1, -980, -978, 0, -976, 0, 1, 0,
+    1, 0, 2, 0, 1, -975, 2, 7, -970, 0, 2, -968,
+    1, 0, 1, -967, -960, -954, 1, -951, -947, -943, 0, -940,
+    -932, 1, 0, 2, 0, -931, -928, -923, 1, 1, 3, 2,
+    0, -919, 1, 1, -915, -911, 0, 0, 0, 1, 1, 0,
+    1, 1, 0, 0, 2, -909, 4, -904, 0, -902, 0, -896,
+    0, -894, -892, 0, -891, 1, 0, -890, 0, 0, 2, 0,
+    -889, 0, 1, 0, -888, 1, -883, -882, 0, 0, 2, 0,
+    -881, 0, -877, 0, 1, -875, 1, 0, 0, 0, -874, -873,
+    0, -872, 0, 1, 0, 0, -871, 0, 0, 5, -870, 0,
+    0, -867, 0, 0, 1, 5, -862, -859, 2, 4, -857, 2,
+    0, 2, 3, -856, -853, 1, 1, -850, 0, 0, -848, 0,
+    0, -841, 0, 1, 0, -839, 0, 0, 0, 1, 1, 2,
+    5, -838, 2, 1, 1, -837, -836, -831, 1, 0, 0, 0,
+    0, -828, 1, 1, -822, -820, 3, 0, -819, 0, 0, 0,
+    -816, 3, 0, 3, -811, 6, -810, -808, -806, 1, -804, -801,
+    0, -796, 1, -783, -780, -775, -773, 0, 2, 0, 1, -771,
+    1, 1, 0, 0, -769, 0, 0, -765, 1, 2, 1, 0,
+    0, -764, 1, 1, -761, 0, -757, 0, 0, 0, -756, 0,
+    0, 0, 2, 0, 2, 1, 0, 1, -754, -750, -743, -742,
+    -735, -733, -730, -727, 0, 1, -726, -719, 0, 0, -713, 1,
+    0, 15, 0, 0, 3, -711, 0, -710, 1, -701, 0, -697,
+    0, 0, -693, 0, -690, 1, -685, 0, 6, 0, 0, 0,
+    3, -682, 0, 0, -680, 3, 0, 1, -679, -677, -675, 1,
+    -673, -672, 0, 0, 0, -666, 1, 3, 0, 1, 3, 2,
+    -664, 0, -659, -654, -653, -651, 0, 0, 1, 1, -648, 1,
+    1, 0, 1, 0, -647, -642, 0, -641, 2, 0, 5, 0,
+    -638, 0, 0, 0, -632, 0, -624, -622, 0, 1, 2, 2,
+    0, 0, 0, -621, -620, -619, 9, -618, -617, -608, 0, 2,
+    -607, -605, -600, 1, 0, 0, 4, -599, 3, 0, 0, 0,
+    1, 1, -595, 0, 0, -593, 0, 5, 2, -591, 1, 1,
+    0, 0, 1, 0, -588, -587, 0, 0, 0, 4, 1, 0,
+    0, 3, -586, 0, 3, 0, -582, -581, 1, -580, 1, 4,
+    0, 1, -570, -568, -567, 0, 0, 1, -565, -563, 1, -561,
+    -560, 8, 0, 5, -559, -558, -556, 0, 0, 0, 0, -552,
+    0, 0, -550, 3, 12, 3, -549, 0, -547, 6, -545, 1,
+    -544, -543, 0, -537, -535, 0, 0, 0, 0, 0, -532, 0,
+    -531, -530, 0, -529, 1, 3, 4, 0, 0, -528, 0, -527,
+    0, 0, 1, 9, 1, 0, -526, 5, 1, 0, -517, 0,
+    2, -514, 6, -513, 0, 0, -511, -510, -508, -506, -504, 2,
+    -501, 0, 0, -496, 8, 0, 6, -489, -487, 0, 4, -486,
+    5, 0, 0, -481, 3, 0, 0, -480, 1, -476, 13, -475,
+    0, -474, -471, -460, -458, 0, 1, -455, -453, -452, 0, 2,
+    -448, 0, 0, 0, 3, 0, 11, 14, 4, -444, 2, 0,
+    2, 0, 0, 0, 0, 4, -443, 0, 0, -442, 0, -437,
+    -435, 1, -432, 0, 0, -429, 2, 7, -427, 0, 0, -426,
+    0, -425, -424, 0, -422, 0, -421, 0, 0, 0, 6, 0,
+    5, 0, 0, 0, -416, -414, 1, -412, 1, 0, 5, 0,
+    0, 3, -408, 8, 0, -399, -397, 0, 0, 0, 0, 1,
+    7, -396, -391, 0, 5, 0, -390, -388, 0, -385, -384, -383,
+    1, -380, 2, 0, -379, 3, -377, 1, 4, 0, 0, 0,
+    11, 0, -375, 0, 3, -374, 0, 6, 2, 0, 0, -371,
+    -368, 1, -367, 0, -366, 0, 0, -365, 0, -362, 0, -356,
+    2, -354, 1, -352, 0, -348, -346, 0, 0, 0, -342, 0,
+    1, -341, 4, 0, 4, 7, -340, 0, 1, 1, 1, 0,
+    6, -339, 2, 4, 0, -338, -335, 0, -328, -327, 1, 0,
+    0, -326, 0, -325, 0, -324, 1, 9, 0, -322, 0, 0,
+    -315, -314, 6, -313, 0, 2, -312, 1, -311, 0, 1, -309,
+    9, 0, 3, -304, 0, -302, -301, -298, -295, 2, -294, -287,
+    4, -285, 0, 0, -281, 0, 0, 3, 0, 0, 1, -280,
+    -279, -277, -274, 0, -273, 0, 1, 0, -272, 0, 0, 2,
+    0, 2, 0, 0, 0, -270, 2, 0, -269, 0, -268, -261,
+    2, -259, 0, 1, 2, 0, -257, -256, 0, 1, -249, -248,
+    0, -243, -242, -240, 0, 0, 0, -239, 0, -235, -234, 0,
+    2, 1, 7, -229, -227, 0, 2, 0, -225, -224, 17, 0,
+    -223, 0, -222, 2, 0, 0, 0, -221, 5, 0, 1, 0,
+    0, 2, 0, -220, 0, 0, 0, 0, -219, -217, 0, -216,
+    -213, 6, 0, 8, -212, 9, 0, 6, -210, -208, -206, -204,
+    -201, -186, 3, -184, 2, -183, 0, 0, 2, 1, -180, -169,
+    7, -164, -158, 7, 0, 0, 0, -156, -154, -151, 4, -149,
+    0, 0, -148, -144, -141, 1, 0, 0, 0, -137, 1, 0,
+    -134, -131, 0, -129, -128, -123, -118, 2, 0, -115, 4, 0,
+    1, 10, 0, 5, 0, 0, 0, 3, 0, -114, 0, 0,
+    -112, 0, 7, 0, -111, 8, -96, 2, 0, -95, 4, 1,
+    1, -94, 1, 0, 6, -91, -90, 0, 1, 0, 0, 0,
+    -88, 0, 11, 0, 1, 0, 0, -81, 3, 0, -80, -79,
+    0, 0, 9, -78, 0, -74, -73, 4, 0, 0, -72, 0,
+    3, 3, -70, -68, 2, -64, -59, 11, 0, 0, 0, 0,
+    15, 3, 0, -56, 0, -55, 0, 8, 8, 0, -53, 0,
+    -40, -38, -29, 0, -28, 5, -23, 12, 1, 0, 9, -22,
+    0, 0, -21, -17, -14, 6, 0, 26, -11, 0, -5, 2,
+    2, 3, 0, 2
+};
+
+static const uint64_t HMS_DB_CODES[HMS_DB_NUM_CODES] = {
+    0x0000000012028013, 0x0700110000010001, 0x0500040000020017, 0x1202120000010001,
+    0x1201230000020006, 0x0702020000010001, 0x0000000007FF8001, 0x1201210000020005,
+    0x1202330000030003, 0x03001C0000010001, 0x0703330000020002, 0x0000000007028007,
+    0x0000000003004001, 0x000000000501401C, 0x0000000012008005, 0x0000000003004006,
+    0x0703210000020002, 0x1202200000020002, 0x0702110000020002, 0x0703200000020005,
+    0x1201210000020002, 0x0000000005014017, 0x1202730000010001, 0x0702200000020004,
+    0x0701130000010003, 0x0700300000010001, 0x1202210000020005, 0x1203720000010001,
+    0x0000000007014001, 0x0000000005014024, 0x12FF200000020001, 0x1200220000020002,
+    0x0703010000010003, 0x0700200000030002, 0x0C00020000020002, 0x0702230000020005,
+    0x0000000007018005, 0x1201210000030002, 0x0000000012024001, 0x03000D000001000B,
+    0x0000000007008011, 0x0703220000020003, 0x0703300000010004, 0x1200300000010001,
+    0x0500030000010002, 0x1200330000010001, 0x1203330000010001, 0x1202800000020001,
+    0x0000000007028004, 0x1200800000020001, 0x0701210000020002, 0x0300020000010006,
+    0x030091000001000C, 0x03000D0000010002, 0x1202200000030001, 0x1202820000020001,
+    0x1203130000010001, 0x0000000012038014, 0x0701110000020002, 0x0300920000010008,
+    0x1200310000010001, 0x050004000002001B, 0x0500040000010006, 0x1200310000020002,
+    0x1200310000030003, 0x1203200000020001, 0x0702300000030003, 0x0000000003008003,
+    0x0000000007FF8010, 0x0C0003000003000D, 0x1201110000010001, 0x1202210000020002,
+    0x03000C0000010001, 0x1200300000010004, 0x0500030000020015, 0x1201220000030001,
+    0x0700210000030002, 0x030092000001000A, 0x1200230000020003, 0x0702350000010001,
+    0x1200210000020006, 0x0700500000020001, 0x1203230000020001, 0x1200210000020001,
+    0x0000000003008008, 0x0701100000010001, 0x0700110000010003, 0x0701210000030002,
+    0x0000000012FF8005, 0x03000B0000010005, 0x0000000005014022, 0x0000000005014032,
+    0x0000000007028005, 0x1200100000010001, 0x0300010000010002, 0x1200110000010001,
+    0x0702310000010004, 0x1200510000030001, 0x0701230000020002, 0x03000B0000010003,
+    0x0000000007038013, 0x0000000012038006, 0x1200220000030002, 0x03000D0000010007,
+    0x1203310000010001, 0x1201200000020001, 0x03000D0000010008, 0x1202220000020004,
+    0x000000000500402F, 0x1200230000030001, 0x0000000007008001, 0x0703610000020001,
+    0x1201120000010001, 0x1201320000030003, 0x0700130000010001, 0x1201210000020006,
+    0x0701120000010001, 0x1200120000010001, 0x1202130000020002, 0x0300930000010006,
+    0x0701100000010003, 0x0300100000020001, 0x0701300000010004, 0x0500040000020019,
+    0x1201310000020002, 0x1203230000020006, 0x0000000003004009, 0x0300900000010004,
+    0x0500020000020005, 0x0000000012FF8004, 0x1202200000020006, 0x0701200000020004,
+    0x050003000001000A, 0x0300070000010002, 0x0C0001000001000B, 0x1202220000030002,
+    0x1200230000020005, 0x000000001000C001, 0x0700010000010004, 0x1202320000030003,
+    0x0300910000010002, 0x0000000012018010, 0x0300200000010004, 0x000000000C00C003,
+    0x03000A0000010002, 0x0701330000020002, 0x0000000012008011, 0x0000000003008010,
+    0x0702110000010003, 0x1201820000020001, 0x0300180000010003, 0x0701230000030001,
+    0x0700220000020005, 0x0500030000010023, 0x0701500000020001, 0x000000000500402B,
+    0x1203110000010001, 0x0000000007028006, 0x03000D0000020004, 0x0000000005004017,
+    0x0C00010000010003, 0x0000000005008013, 0x000000000C008002, 0x0700230000030002,
+    0x0500030000010003, 0x0703220000020002, 0x0703620000020001, 0x1203300000030003,
+    0x0000000003004000, 0x0000000005004005, 0x0300160000010001, 0x0700220000030001,
+    0x1201210000020001, 0x1202210000020004, 0x0700400000020004, 0x0C00030000020010,
+    0x1202200000020003, 0x0700350000010001, 0x03000D0000020006, 0x1203230000020003,
+    0x0300920000010007, 0x0701610000020001, 0x0000000012028012, 0x0000000012028016,
+    0x0000000005004001, 0x1203730000010001, 0x1202710000010001, 0x0000000012038007,
+    0x0C00020000020006, 0x0300900000010003, 0x1202220000030001, 0x1200200000020005,
+    0x1202320000020002, 0x1200220000020004, 0x1200450000020002, 0x0000000007018012,
+    0x0700450000020002, 0x0702330000020002, 0x0703010000020002, 0x1203120000020002,
+    0x0700120000020002, 0x0700100000020002, 0x1202210000030002, 0x1203300000010001,
+    0x0000000005004003, 0x0701320000020002, 0x1202330000010001, 0x0702130000010001,
+    0x0701220000020004, 0x03000B0000010002, 0x0700330000020002, 0x0703100000010001,
+    0x0703130000020002, 0x0500040000020012, 0x0000000003008002, 0x0000000012018005,
+    0x1200700000010001, 0x03000D0000010009, 0x03000D0000020005, 0x0701130000010001,
+    0x0000000005004037, 0x0300180000010004, 0x000000000500400B, 0x0700230000020001,
+    0x0000000007018001, 0x0701300000030003, 0x0700130000020002, 0x07FF200000020002,
+    0x0703220000020001, 0x0500020000020003, 0x0701020000010001, 0x0702310000010001,
+    0x1203500000020001, 0x1203210000020002, 0x000000000500402E, 0x0C0003000003000B,
+    0x0000000012FF8002, 0x0300200000010001, 0x0500030000020014, 0x1200230000020004,
+    0x0300900000010010, 0x0000000005004008, 0x0702300000020002, 0x0300130000010001,
+    0x1200210000020003, 0x0000000012028010, 0x0C0003000003000E, 0x0C00030000030008,
+    0x000000000300400A, 0x1201300000020002, 0x0C00020000020004, 0x0701200000020003,
+    0x0000000007FF8012, 0x0300020000010009, 0x0000000007FF8011, 0x1203120000010001,
+    0x0700630000020001, 0x1201800000020001, 0x0703110000010001, 0x0000000003004003,
+    0x1203100000020002, 0x050004000002001E, 0x1201220000030002, 0x0703500000020001,
+    0x0000000005004009, 0x1200300000020002, 0x03001B0000010003, 0x0500030000010024,
+    0x0700310000010001, 0x0702210000020003, 0x12FF200000020007, 0x0000000012FF8010,
+    0x0000000012038003, 0x0000000007008005, 0x000000000501401A, 0x0000000005004016,
+    0x0000000005004022, 0x000000000501401E, 0x1203210000030002, 0x0703230000020002,
+    0x0702210000030001, 0x0701600000020001, 0x0000000012038015, 0x0700100000010003,
+    0x0703310000010001, 0x0700010000010001, 0x0000000012038004, 0x0702200000030001,
+    0x0000000007018013, 0x000000000500402D, 0x0700400000020001, 0x1201230000020005,
+    0x000000000501401F, 0x0700230000020003, 0x050004000002001C, 0x0000000007008002,
+    0x0701200000030002, 0x0703200000020002, 0x1203320000020002, 0x0700010000020002,
+    0x0000000007008004, 0x0703220000030001, 0x0000000012038001, 0x0000000003008000,
+    0x000000000300800D, 0x0000000007038011, 0x1200100000020002, 0x1200810000020001,
+    0x1203230000020005, 0x1200230000020001, 0x0701120000020002, 0x1202230000020002,
+    0x000000000C00C004, 0x0000000007038001, 0x1202700000010001, 0x0500040000010001,
+    0x0300020000010001, 0x0701010000010004, 0x0000000007018002, 0x0000000007028011,
+    0x0000000003004008, 0x0000000007028002, 0x000000000500401A, 0x1200220000020005,
+    0x1202310000020002, 0x03000D000002000A, 0x03001D0000010001, 0x1200250000020001,
+    0x000000000500C010, 0x000000000300400C, 0x0300920000010001, 0x1200130000020002,
+    0x000000000500401B, 0x0000000012028007, 0x0500030000010009, 0x0000000012FF4001,
+    0x03000F0000010001, 0x0000000005014029, 0x0701350000010001, 0x1200200000020002,
+    0x0702100000010003, 0x03000D0000020007, 0x0500030000010008, 0x0000000007FF8006,
+    0x030091000001000A, 0x0701300000020002, 0x0702610000020001, 0x0C00020000020003,
+    0x1202220000020003, 0x000000000300800E, 0x1201120000010003, 0x0000000005014035,
+    0x1203130000010003, 0x1203210000020006, 0x0702200000020003, 0x0500020000020008,
+    0x0300930000010003, 0x1201110000010003, 0x1201200000020004, 0x0702230000020003,
+    0x1202810000020001, 0x0000000003008015, 0x0702210000020001, 0x0700510000030001,
+    0x1203310000030003, 0x1200720000010001, 0x0C00010000020008, 0x0701130000020002,
+    0x1202200000020005, 0x0701300000010001, 0x0000000012018013, 0x0000000005014025,
+    0x1201810000020001, 0x0000000007018003, 0x000000000500403A, 0x1201100000020002,
+    0x0000000012038010, 0x0000000005004004, 0x1203210000030001, 0x0300200000010003,
+    0x0700210000020002, 0x0701220000020005, 0x0300930000010008, 0x03000D0000020008,
+    0x0300060000010001, 0x1203200000030002, 0x03001A0000020001, 0x0702210000030002,
+    0x0000000012038005, 0x0000000007008007, 0x1201320000010001, 0x1203200000020003,
+    0x0700120000010001, 0x1200200000030002, 0x0000000005014028, 0x1201320000020002,
+    0x0000000005004021, 0x0300010000030008, 0x0000000012008002, 0x0000000012FF8013,
+    0x1203210000020001, 0x0700020000010001, 0x0000000012008015, 0x000000000500401F,
+    0x000000000501401D, 0x0701210000020003, 0x0700400000020003, 0x0300200000010002,
+    0x0000000007038003, 0x0C00030000020002, 0x0500030000030022, 0x0000000005004007,
+    0x0500030000010001, 0x1201200000020006, 0x0000000005004026, 0x1201100000010001,
+    0x1203810000020001, 0x0500020000020006, 0x0500040000020010, 0x0703230000020003,
+    0x0700220000020002, 0x0500040000020020, 0x0000000007FF4001, 0x1203100000010003,
+    0x0702620000020001, 0x1203220000020004, 0x0000000007FF8013, 0x0000000003008001,
+    0x1202230000030001, 0x1200210000020004, 0x0000000007038004, 0x1201230000020003,
+    0x1202320000010001, 0x0C00010000010009, 0x0000000007FF8002, 0x0000000012018003,
+    0x0703010000010004, 0x0701200000020001, 0x1202500000020001, 0x1202210000020006,
+    0x0701230000020004, 0x0300190000020002, 0x0000000012038016, 0x0000000012028002,
+    0x0C00030000030007, 0x0C0003000002000F, 0x0000000005004006, 0x0C00010000010005,
+    0x0700310000010004, 0x1200200000020004, 0x0000000012014001, 0x0500020000020001,
+    0x1202100000010003, 0x0500010000020002, 0x1203220000020003, 0x0702220000020003,
+    0x0703120000010001, 0x1201220000020002, 0x1200200000020001, 0x0500040000010004,
+    0x1202230000020006, 0x0000000012038013, 0x03000D0000010003, 0x1200220000020003,
+    0x1201200000030002, 0x0703210000020003, 0x0701230000020001, 0x0000000005004029,
+    0x1200330000030003, 0x1202220000020001, 0x0000000012FF8003, 0x0702220000030001,
+    0x0701010000020002, 0x0703220000030002, 0x0000000012008014, 0x0700210000030001,
+    0x000000000500401E, 0x0300080000010001, 0x12FF200000020002, 0x0700210000020004,
+    0x0000000007028010, 0x0000000007FF8004, 0x0300070000010001, 0x0700310000020002,
+    0x0703210000030002, 0x0500030000020013, 0x0300900000010005, 0x0700610000020001,
+    0x1202110000020002, 0x0000000012008013, 0x0000000012028015, 0x0C0003000001000A,
+    0x0000000012008012, 0x000000000C008001, 0x0700230000020002, 0x03000D0000010005,
+    0x1203220000030001, 0x0702230000020004, 0x0702210000020004, 0x0000000012FFC006,
+    0x0703300000010001, 0x0703110000020002, 0x0702200000030002, 0x0000000007034001,
+    0x0701010000010001, 0x1200820000020001, 0x1200110000010003, 0x0000000005004038,
+    0x0000000007018011, 0x1201130000010003, 0x1201230000020001, 0x030001000001000D,
+    0x0000000003008018, 0x1202230000020004, 0x03000A0000010005, 0x0500030000020020,
+    0x0000000012018012, 0x000000000500400A, 0x03000D000001000A, 0x0000000007FFC003,
+    0x0702130000010003, 0x0000000003008016, 0x0701200000020002, 0x1203230000020002,
+    0x1200450000020003, 0x0701210000030001, 0x0702210000020005, 0x1203230000030002,
+    0x0500030000020011, 0x0703310000020002, 0x0300930000010005, 0x0000000007FF8005,
+    0x0000000005014021, 0x0703220000020004, 0x0700230000020004, 0x1203700000010001,
+    0x0702010000010003, 0x000000000500C011, 0x03000D0000010006, 0x0702230000030002,
+    0x0703300000020002, 0x1200100000010003, 0x1200200000020006, 0x0300170000010001,
+    0x0703130000010003, 0x1203210000020004, 0x0701110000010003, 0x1201230000030001,
+    0x1201230000020002, 0x0701220000020003, 0x0700310000030003, 0x0500050000010001,
+    0x0000000007038007, 0x0300170000020002, 0x0000000005004019, 0x0300400000020001,
+    0x0300010000010007, 0x1202230000020005, 0x0300120000020001, 0x0701220000030002,
+    0x0300910000010007, 0x0500040000020013, 0x1200450000020001, 0x0300930000010002,
+    0x1203210000020005, 0x0300090000010003, 0x0500010000020003, 0x1201330000010001,
+    0x0703310000010004, 0x0000000012FF8007, 0x0C00020000020007, 0x0000000012028003,
+    0x000000001001C001, 0x1203220000020002, 0x030001000001000A, 0x1201220000020003,
+    0x0700220000020003, 0x0300020000010002, 0x0700200000020005, 0x000000000300800B,
+    0x0700200000030001, 0x0000000005014038, 0x1203200000020002, 0x1202220000020002,
+    0x0300090000010002, 0x1200210000030002, 0x0000000005014033, 0x1200320000020002,
+    0x0C00020000020008, 0x0300070000010003, 0x1203820000020001, 0x0000000012008007,
+    0x0701010000010003, 0x0300180000010002, 0x0701220000020002, 0x0702220000020005,
+    0x03000A0000010004, 0x03000D0000020003, 0x0000000012038002, 0x0500030000020010,
+    0x1202100000020002, 0x0703310000030003, 0x0700110000020002, 0x1203200000020004,
+    0x0703130000010001, 0x0300060000010002, 0x050003000001000B, 0x1202300000010004,
+    0x1202230000030002, 0x0000000005014018, 0x0000000007FF8003, 0x1200220000030001,
+    0x0000000007008003, 0x0703320000020002, 0x12FF200000020006, 0x1202120000010003,
+    0x0700300000020002, 0x0000000007024001, 0x0700220000020001, 0x1200200000030001,
+    0x0000000005008030, 0x0300050000010001, 0x000000000300800F, 0x1201130000020002,
+    0x03000A0000010003, 0x0000000003008004, 0x1200230000020002, 0x0000000012028014,
+    0x000000000300800A, 0x03000C0000010002, 0x1200230000030002, 0x0300010000010006,
+    0x1203210000020003, 0x0300190000010001, 0x0701100000020002, 0x0000000012FF8006,
+    0x0000000012008004, 0x0703350000010001, 0x0701230000020005, 0x0300920000010006,
+    0x000000001000C002, 0x1201220000020004, 0x0700210000020001, 0x0703210000030001,
+    0x0000000012FF8012, 0x0703210000020001, 0x0702100000020002, 0x0000000012FFC003,
+    0x1201200000030001, 0x1200220000020001, 0x0300020000010007, 0x0701310000030003,
+    0x0700200000020001, 0x0000000007018004, 0x0500040000030009, 0x0000000012008003,
+    0x050003000002000C, 0x0300090000010001, 0x0701310000020002, 0x0700010000010003,
+    0x1202100000010001, 0x0000000005014026, 0x0703230000030001, 0x1201300000010001,
+    0x0C00030000010009, 0x0702320000020002, 0x1200710000010001, 0x0000000012028006,
+    0x03000D0000010004, 0x1201200000020005, 0x1201230000020004, 0x0C00010000020007,
+    0x0300020000010003, 0x030001000001000C, 0x1200120000020002, 0x0700100000010001,
+    0x0000000005014027, 0x1201700000010001, 0x050004000002001F, 0x0300900000010002,
+    0x1203320000030003, 0x0703020000010001, 0x1200240000020001, 0x0000000007008013,
+    0x1200110000020002, 0x0C00030000020001, 0x0000000003004005, 0x0000000012018006,
+    0x0500030000020018, 0x0701210000020001, 0x0000000012008006, 0x0000000003008005,
+    0x0500040000020011, 0x0000000012018014, 0x000000000501401B, 0x03000A0000010001,
+    0x0702200000020005, 0x0702120000010003, 0x1201100000010003, 0x0000000005014019,
+    0x0000000012034001, 0x1201110000020002, 0x0000000005004002, 0x050003000002000D,
+    0x0C00010000020006, 0x0700200000020003, 0x050004000002001D, 0x1200830000020001,
+    0x1203110000010003, 0x0500040000030008, 0x1202220000020005, 0x050004000002001A,
+    0x0700230000030001, 0x0300110000020002, 0x0700200000020002, 0x0000000003008006,
+    0x1202210000020001, 0x1201830000020001, 0x03000C0000010004, 0x0700210000020003,
+    0x0000000003004004, 0x1201220000020006, 0x12FF800000020001, 0x1203120000010003,
+    0x0500030000030007, 0x0300930000010001, 0x0000000007018010, 0x1203310000020002,
+    0x0701120000010003, 0x0702200000020002, 0x0000000005004024, 0x0000000012FF8001,
+    0x0C00030000030006, 0x12FF200000020005, 0x03000D0000020001, 0x0701630000020001,
+    0x000000000500402C, 0x1203200000030001, 0x0500040000020014, 0x0703200000020003,
+    0x0703230000020005, 0x0000000012018015, 0x0701210000020005, 0x0000000003008012,
+    0x0C00030000020004, 0x0000000003008009, 0x1203330000030003, 0x0500030000020016,
+    0x0000000000514039, 0x0000000007008010, 0x0703210000020004, 0x0703230000020001,
+    0x0500040000010003, 0x0702230000020002, 0x0300040000020001, 0x0300180000010001,
+    0x03000C0000010005, 0x0702210000020002, 0x0000000007038002, 0x1202720000010001,
+    0x1203300000010004, 0x12FF200000030007, 0x0C00010000010001, 0x1202130000010003,
+    0x1201330000020002, 0x1200120000010003, 0x1201210000030001, 0x1200320000030003,
+    0x0000000005008036, 0x0000000007028001, 0x0000000012008001, 0x1202230000020003,
+    0x0500010000030006, 0x000000000500401D, 0x0701220000030001, 0x0000000005004020,
+    0x03000C0000010003, 0x0C00030000020005, 0x000000000500401C, 0x0702600000020001,
+    0x0000000005004027, 0x0701310000010001, 0x0700300000010004, 0x0C0003000002000C,
+    0x03001B0000010001, 0x1202830000020001, 0x1202200000020001, 0x1202300000030003,
+    0x0700220000030002, 0x1203220000020005, 0x0300910000010006, 0x0300410000010001,
+    0x000000000300400B, 0x0500040000020016, 0x1200200000020003, 0x0700450000020003,
+    0x1200220000020006, 0x0300940000030002, 0x1202310000010001, 0x0500030000020012,
+    0x0703300000030003, 0x1203230000020004, 0x0000000007008012, 0x0703230000020004,
+    0x000000000C008009, 0x0700300000030003, 0x0C00020000010005, 0x0500010000030005,
+    0x1201330000030003, 0x0500020000020002, 0x0000000003008017, 0x0000000003008014,
+    0x0000000012018016, 0x0500010000030004, 0x1203130000020002, 0x1201200000020003,
+    0x0701200000020005, 0x0702130000020002, 0x1201310000010001, 0x1200210000020002,
+    0x1203220000020006, 0x0000000005004018, 0x12FF200000020004, 0x0000000007038006,
+    0x0000000012018011, 0x0000000012028011, 0x0C00020000020009, 0x1200210000030001,
+    0x000000000C008005, 0x1200500000020001, 0x0700600000020001, 0x0000000007004001,
+    0x0703230000030002, 0x0000000012018002, 0x0300150000010001, 0x0500010000030007,
+    0x1203220000030002, 0x0500040000020018, 0x1201220000020005, 0x0000000012008010,
+    0x0300030000020002, 0x0000000007038005, 0x0703200000020004, 0x0500030000010004,
+    0x1200300000030003, 0x03001B0000010002, 0x0300030000010001, 0x0702230000020001,
+    0x07FF200000020004, 0x1202110000010001, 0x0000000003008011, 0x000000000500400D,
+    0x03000B0000010004, 0x0500030000020017, 0x0300010000010003, 0x0000000005014031,
+    0x0700620000020001, 0x0300060000010003, 0x0500020000020004, 0x0C0001000001000A,
+    0x1201710000010001, 0x0000000007018007, 0x0000000007008006, 0x000000000500400E,
+    0x1200330000020002, 0x1201200000020002, 0x0C00010000020002, 0x0300910000010008,
+    0x0701220000020001, 0x0000000007FFC006, 0x1201230000030002, 0x0000000012018001,
+    0x000000000300400D, 0x1203200000020005, 0x0000000007028013, 0x0500010000020001,
+    0x1201220000020001, 0x0300940000030001, 0x0702230000030001, 0x0700210000020005,
+    0x0702630000020001, 0x1201300000010004, 0x0000000005014023, 0x000000000C00C006,
+    0x0702500000020001, 0x0300910000010003, 0x0703100000010003, 0x000000001000C003,
+    0x0000000012038012, 0x0702310000020002, 0x0703200000030002, 0x0000000007028012,
+    0x0703120000020002, 0x0701230000020003, 0x0000000012038011, 0x1203110000020002,
+    0x1203300000020002, 0x0000000012028005, 0x0000000007028003, 0x0703120000010003,
+    0x030002000001000B, 0x1201210000020003, 0x1202310000030003, 0x0703110000010003,
+    0x1200730000010001, 0x1201210000020004, 0x1201310000030003, 0x0500040000020007,
+    0x0701200000030001, 0x0C0003000003000F, 0x1202130000010001, 0x1202330000020002,
+    0x0500050000030002, 0x1200130000010001, 0x0500030000010005, 0x0300920000010003,
+    0x0703010000010001, 0x1200210000020005, 0x0701110000010001, 0x1203220000020001,
+    0x0000000003008007, 0x0703210000020005, 0x1201130000010001, 0x0702200000020001,
+    0x0300080000010002, 0x0000000003008013, 0x0300930000010007, 0x1202210000030001,
+    0x03000B0000010001, 0x1203100000010001, 0x0703200000020001, 0x000000000300800C,
+    0x0700120000010003, 0x1203710000010001, 0x0000000003008019, 0x0000000003004002,
+    0x0702120000020002, 0x0702300000010004, 0x0500030000010021, 0x0300900000010001,
+    0x0300920000010002, 0x0300100000020002, 0x0700230000020005, 0x0702100000010001,
+    0x0000000012028004, 0x0701230000030002, 0x000000000500402A, 0x1202230000020001,
+    0x1203200000020006, 0x0702120000010001, 0x0702110000010001, 0x0000000005004015,
+    0x1200320000010001, 0x1201300000030003, 0x1200130000010003, 0x0000000007FF8007,
+    0x0702220000020004, 0x0701310000010004, 0x1202210000020003, 0x0300110000020001,
+    0x0702300000010001, 0x0000000007038010, 0x000000000300400F, 0x0000000007018006,
+    0x0700220000020004, 0x000000000C00800A, 0x0500040000020015, 0x0C00020000010001,
+    0x1202200000030002, 0x0700130000010003, 0x0703220000020005, 0x0703600000020001,
+    0x0703630000020001, 0x0700320000020002, 0x1200230000020006, 0x0000000005004014,
+    0x000000000300400E, 0x0000000005014020, 0x0300080000010003, 0x1202220000020006,
+    0x0700400000020002, 0x0300140000010001, 0x0000000005004023, 0x000000001001C002,
+    0x0702220000020002, 0x1203830000020001, 0x0700200000020004, 0x0300930000010004,
+    0x1202300000010001, 0x07FF200000020001, 0x03001A0000020002, 0x0700450000020001,
+    0x0000000012FF8011, 0x000000000500400C, 0x1203800000020001, 0x0702310000030003,
+    0x1203330000020002, 0x0500030000010006, 0x0000000012018004, 0x1202120000020002,
+    0x0000000012004001, 0x1201120000020002, 0x0703100000020002, 0x1203230000030001,
+    0x1201720000010001, 0x0702220000020001, 0x1201730000010001, 0x0300180000010005,
+    0x0000000007038012, 0x0000000012018007, 0x0000000005004025, 0x0500040000010002,
+    0x0701620000020001, 0x0300910000010001, 0x0702010000020002, 0x0000000005004028,
+    0x0000000012028001, 0x0500020000020007, 0x0300010000010001, 0x0000000005004012,
+    0x0C00010000010004, 0x0300940000020003, 0x0702010000010004, 0x0703200000030001,
+    0x03000D0000020009, 0x1201500000020001, 0x0702010000010001, 0x0000000005014034,
+    0x0701210000020004, 0x1203320000010001, 0x0300010000010008, 0x1202300000020002,
+    0x1202200000020004, 0x0702220000030002, 0x1202110000010003, 0x0000000012008016
+};
+
+static const uint16_t HMS_DB_MESSAGE_IDS[HMS_DB_NUM_CODES] = {
+    813, 508, 652, 557, 343, 145, 334, 102, 195, 709, 677, 353,
+    759, 312, 360, 744, 244, 162, 573, 220, 111, 285, 149, 160,
+    550, 623, 168, 214, 379, 310, 377, 60, 598, 20, 734, 199,
+    482, 101, 380, 681, 10, 260, 322, 19, 800, 64, 262, 161,
+    366, 29, 112, 752, 688, 400, 157, 191, 592, 329, 541, 290,
+    34, 664, 376, 636, 33, 224, 460, 471, 7, 470, 522, 177,
+    398, 461, 835, 121, 35, 793, 72, 786, 337, 78, 269, 41,
+    449, 536, 510, 101, 360, 391, 314, 459, 358, 487, 729, 490,
+    322, 12, 142, 774, 812, 356, 50, 684, 232, 92, 684, 190,
+    621, 70, 334, 603, 525, 114, 516, 341, 544, 493, 561, 297,
+    538, 766, 322, 658, 648, 351, 403, 293, 331, 370, 344, 94,
+    477, 418, 327, 182, 66, 402, 501, 180, 790, 431, 827, 440,
+    773, 653, 10, 736, 574, 125, 708, 135, 52, 615, 144, 466,
+    586, 357, 684, 285, 475, 755, 472, 65, 486, 259, 607, 216,
+    450, 445, 693, 54, 107, 175, 713, 394, 159, 786, 684, 270,
+    798, 539, 363, 707, 332, 215, 147, 354, 426, 294, 187, 21,
+    663, 58, 717, 362, 718, 665, 596, 590, 513, 505, 167, 217,
+    451, 650, 196, 580, 124, 775, 641, 600, 613, 637, 385, 359,
+    14, 684, 684, 548, 832, 699, 807, 68, 334, 460, 517, 325,
+    251, 331, 79, 628, 276, 243, 784, 404, 698, 824, 834, 73,
+    689, 473, 656, 691, 42, 431, 831, 442, 408, 645, 427, 98,
+    362, 747, 11, 589, 515, 95, 604, 428, 584, 673, 116, 276,
+    446, 633, 725, 696, 624, 179, 328, 430, 371, 483, 309, 622,
+    314, 314, 233, 274, 171, 535, 368, 506, 630, 499, 370, 156,
+    812, 476, 712, 132, 283, 77, 667, 697, 86, 229, 675, 500,
+    8, 252, 334, 455, 469, 10, 488, 44, 264, 71, 545, 207,
+    443, 334, 146, 335, 750, 533, 698, 10, 481, 698, 309, 51,
+    660, 684, 754, 352, 415, 452, 795, 497, 314, 354, 3, 380,
+    277, 312, 786, 30, 570, 684, 4, 432, 787, 644, 571, 732,
+    189, 755, 527, 702, 594, 349, 164, 809, 298, 524, 94, 209,
+    176, 719, 170, 485, 231, 16, 364, 549, 153, 625, 813, 314,
+    110, 372, 695, 520, 431, 757, 238, 825, 46, 118, 302, 684,
+    417, 218, 746, 167, 360, 326, 115, 225, 512, 20, 314, 651,
+    308, 799, 698, 813, 239, 13, 374, 283, 308, 113, 479, 826,
+    371, 388, 414, 444, 616, 340, 313, 519, 242, 474, 631, 275,
+    61, 0, 379, 585, 575, 256, 812, 454, 202, 43, 366, 138,
+    181, 687, 698, 371, 597, 89, 210, 345, 139, 770, 707, 698,
+    441, 429, 806, 409, 322, 28, 380, 330, 553, 816, 255, 194,
+    608, 126, 26, 756, 347, 813, 684, 57, 86, 245, 134, 312,
+    63, 188, 436, 186, 532, 248, 720, 39, 314, 423, 382, 43,
+    7, 367, 419, 635, 233, 842, 295, 507, 555, 813, 368, 830,
+    361, 386, 76, 684, 253, 205, 175, 432, 629, 605, 152, 379,
+    531, 59, 492, 740, 10, 530, 137, 282, 304, 205, 390, 412,
+    363, 722, 684, 436, 582, 742, 97, 273, 714, 105, 169, 263,
+    841, 671, 296, 358, 308, 256, 73, 212, 566, 0, 684, 197,
+    668, 489, 336, 782, 614, 241, 542, 136, 141, 128, 460, 710,
+    353, 780, 758, 316, 731, 198, 724, 116, 792, 640, 715, 301,
+    234, 763, 815, 130, 322, 306, 803, 371, 811, 258, 735, 123,
+    62, 751, 22, 697, 24, 760, 228, 192, 420, 35, 828, 639,
+    804, 762, 257, 355, 534, 771, 127, 184, 279, 684, 698, 837,
+    552, 460, 509, 226, 612, 416, 769, 463, 197, 284, 437, 55,
+    373, 674, 352, 559, 632, 379, 53, 25, 0, 738, 704, 529,
+    772, 384, 75, 329, 1, 777, 65, 730, 240, 705, 537, 432,
+    370, 786, 133, 797, 447, 124, 38, 237, 363, 236, 569, 436,
+    91, 56, 753, 460, 23, 8, 682, 371, 823, 421, 647, 502,
+    551, 313, 267, 85, 723, 662, 15, 356, 684, 87, 139, 411,
+    749, 726, 494, 504, 311, 80, 676, 292, 246, 211, 381, 812,
+    491, 378, 741, 356, 840, 104, 818, 814, 634, 329, 314, 396,
+    154, 578, 521, 758, 380, 523, 822, 679, 410, 32, 670, 74,
+    588, 703, 183, 661, 69, 767, 31, 686, 173, 140, 281, 47,
+    401, 342, 721, 591, 5, 300, 480, 672, 546, 163, 310, 334,
+    458, 381, 399, 547, 365, 223, 643, 230, 265, 369, 103, 0,
+    387, 401, 261, 836, 320, 480, 241, 266, 690, 208, 783, 801,
+    392, 178, 698, 148, 464, 307, 619, 562, 654, 495, 106, 48,
+    833, 334, 315, 204, 821, 308, 120, 313, 776, 389, 312, 567,
+    311, 626, 322, 685, 778, 206, 158, 150, 50, 249, 791, 785,
+    405, 649, 27, 714, 338, 305, 166, 838, 460, 271, 362, 271,
+    286, 460, 2, 413, 129, 319, 393, 745, 707, 425, 593, 93,
+    88, 581, 100, 45, 350, 284, 435, 357, 9, 9, 802, 40,
+    456, 78, 503, 484, 263, 698, 694, 819, 248, 655, 117, 383,
+    0, 358, 226, 478, 18, 323, 781, 200, 438, 554, 317, 439,
+    280, 839, 727, 318, 511, 761, 820, 617, 81, 353, 818, 452,
+    642, 96, 618, 289, 119, 432, 131, 334, 465, 219, 812, 737,
+    122, 287, 201, 37, 579, 462, 313, 457, 210, 788, 602, 321,
+    363, 659, 218, 362, 609, 143, 9, 587, 669, 360, 371, 610,
+    748, 108, 165, 606, 17, 109, 99, 683, 90, 829, 560, 666,
+    701, 496, 406, 794, 595, 36, 540, 254, 808, 235, 528, 155,
+    422, 453, 303, 172, 397, 583, 221, 467, 514, 213, 424, 448,
+    577, 322, 395, 291, 796, 765, 67, 568, 370, 131, 333, 203,
+    348, 576, 572, 805, 49, 84, 498, 434, 190, 322, 174, 768,
+    627, 7, 424, 817, 58, 700, 646, 733, 152, 518, 250, 599,
+    611, 638, 339, 468, 739, 313, 764, 346, 711, 692, 313, 810,
+    193, 272, 28, 299, 151, 324, 743, 716, 9, 433, 227, 460,
+    678, 6, 370, 558, 380, 526, 601, 268, 82, 185, 83, 680,
+    362, 354, 314, 375, 543, 789, 564, 314, 334, 407, 728, 704,
+    620, 288, 565, 222, 684, 144, 563, 779, 109, 247, 278, 657,
+    160, 182, 556, 706
+};
+
+static const uint16_t HMS_DB_MESSAGE_OFFSETS[HMS_DB_NUM_MESSAGES + 1] = {
+    0, 2, 29, 51, 71, 84, 104, 117, 138, 172, 191, 208,
+    227, 238, 250, 265, 280, 295, 310, 321, 337, 354, 378, 402,
+    413, 427, 441, 452, 463, 473, 481, 490, 499, 508, 519, 535,
+    552, 576, 600, 611, 625, 639, 650, 661, 671, 679, 688, 697,
+    706, 717, 733, 750, 774, 798, 809, 823, 837, 848, 859, 869,
+    877, 886, 895, 904, 915, 931, 948, 972, 996, 1007, 1021, 1035,
+    1046, 1057, 1067, 1075, 1084, 1093, 1102, 1114, 1126, 1141, 1156, 1171,
+    1186, 1197, 1213, 1230, 1254, 1278, 1289, 1303, 1317, 1328, 1339, 1349,
+    1357, 1366, 1375, 1384, 1395, 1411, 1428, 1452, 1476, 1487, 1501, 1515,
+    1526, 1537, 1547, 1555, 1564, 1573, 1582, 1593, 1609, 1626, 1650, 1674,
+    1685, 1699, 1713, 1724, 1735, 1745, 1753, 1762, 1771, 1780, 1791, 1807,
+    1824, 1848, 1872, 1883, 1897, 1911, 1922, 1933, 1943, 1951, 1960, 1969,
+    1978, 1990, 2002, 2017, 2032, 2047, 2062, 2073, 2089, 2106, 2130, 2154,
+    2165, 2179, 2193, 2204, 2215, 2225, 2233, 2242, 2251, 2260, 2271, 2287,
+    2304, 2328, 2352, 2363, 2377, 2391, 2402, 2413, 2423, 2431, 2440, 2449,
+    2458, 2469, 2485, 2502, 2526, 2550, 2561, 2575, 2589, 2600, 2611, 2621,
+    2629, 2638, 2647, 2656, 2667, 2683, 2700, 2724, 2748, 2759, 2773, 2787,
+    2798, 2809, 2819, 2827, 2836, 2845, 2854, 2866, 2878, 2893, 2908, 2923,
+    2938, 2949, 2965, 2982, 3006, 3030, 3041, 3055, 3069, 3080, 3091, 3101,
+    3109, 3118, 3127, 3136, 3147, 3163, 3180, 3204, 3228, 3239, 3253, 3267,
+    3278, 3289, 3299, 3307, 3316, 3325, 3334, 3345, 3361, 3378, 3402, 3426,
+    3437, 3451, 3465, 3476, 3487, 3497, 3505, 3514, 3523, 3532, 3543, 3559,
+    3576, 3600, 3624, 3635, 3649, 3663, 3674, 3685, 3695, 3703, 3712, 3721,
+    3730, 3742, 3757, 3783, 3812, 3841, 3870, 3903, 3956, 3972, 3985, 3997,
+    4027, 4052, 4066, 4080, 4098, 4137, 4153, 4169, 4182, 4205, 4228, 4251,
+    4274, 4290, 4306, 4325, 4345, 4349, 4370, 4396, 4411, 4455, 4521, 4588,
+    4632, 4663, 4693, 4724, 4748, 4769, 4801, 4870, 4883, 4897, 4918, 4924,
+    4949, 4960, 4971, 4982, 5014, 5033, 5059, 5072, 5085, 5101, 5151, 5169,
+    5182, 5208, 5234, 5260, 5286, 5312, 5338, 5364, 5390, 5416, 5442, 5468,
+    5494, 5520, 5546, 5572, 5598, 5610, 5629, 5658, 5685, 5709, 5736, 5773,
+    5790, 5807, 5825, 5840, 5858, 5886, 5969, 6000, 6032, 6065, 6100, 6125,
+    6161, 6188, 6217, 6248, 6262, 6270, 6285, 6316, 6349, 6381, 6389, 6402,
+    6408, 6416, 6449, 6478, 6493, 6510, 6530, 6561, 6592, 6623, 6656, 6673,
+    6682, 6719, 6756, 6793, 6819, 6833, 6838, 6863, 6870, 6882, 6888, 6899,
+    6914, 6923, 6939, 6964, 6981, 6997, 7012, 7053, 7073, 7084, 7105, 7116,
+    7135, 7146, 7165, 7176, 7195, 7204, 7222, 7246, 7278, 7283, 7309, 7319,
+    7335, 7358, 7371, 7408, 7423, 7475, 7524, 7535, 7546, 7560, 7594, 7622,
+    7631, 7658, 7676, 7694, 7711, 7723, 7732, 7744, 7766, 7771, 7793, 7816,
+    7840, 7865, 7880, 7903, 7966, 7977, 7993, 8009, 8025, 8041, 8051, 8073,
+    8102, 8120, 8157, 8190, 8224, 8231, 8249, 8279, 8299, 8303, 8316, 8328,
+    8347, 8369, 8377, 8426, 8478, 8518, 8530, 8541, 8560, 8573, 8587, 8606,
+    8619, 8633, 8652, 8665, 8679, 8698, 8711, 8725, 8747, 8760, 8774, 8788,
+    8805, 8825, 8839, 8854, 8871, 8891, 8905, 8920, 8937, 8957, 8971, 8986,
+    9003, 9023, 9037, 9052, 9071, 9084, 9098, 9117, 9130, 9144, 9163, 9176,
+    9190, 9209, 9222, 9236, 9258, 9271, 9285, 9299, 9316, 9336, 9350, 9365,
+    9382, 9402, 9416, 9431, 9448, 9468, 9482, 9497, 9514, 9534, 9548, 9563,
+    9582, 9595, 9609, 9628, 9641, 9655, 9674, 9687, 9701, 9720, 9733, 9747,
+    9769, 9782, 9796, 9810, 9827, 9847, 9861, 9876, 9893, 9913, 9927, 9942,
+    9959, 9979, 9993, 10008, 10025, 10045, 10059, 10074, 10093, 10106, 10120, 10139,
+    10152, 10166, 10185, 10198, 10212, 10231, 10244, 10258, 10280, 10293, 10307, 10321,
+    10338, 10358, 10372, 10387, 10404, 10424, 10438, 10453, 10470, 10490, 10504, 10519,
+    10536, 10556, 10570, 10585, 10597, 10618, 10628, 10664, 10679, 10699, 10747, 10763,
+    10777, 10791, 10805, 10819, 10833, 10847, 10861, 10875, 10883, 10898, 10905, 10913,
+    10928, 10935, 10943, 10958, 10965, 10973, 10988, 10995, 11003, 11018, 11025, 11033,
+    11048, 11055, 11063, 11078, 11085, 11093, 11108, 11115, 11123, 11138, 11145, 11153,
+    11168, 11175, 11183, 11198, 11205, 11213, 11228, 11235, 11243, 11258, 11265, 11273,
+    11288, 11295, 11303, 11318, 11325, 11333, 11348, 11355, 11364, 11413, 11457, 11504,
+    11547, 11563, 11589, 11632, 11650, 11681, 11691, 11706, 11730, 11754, 11778, 11802,
+    11856, 11905, 11922, 11941, 11958, 11974, 11999, 12020, 12030, 12046, 12066, 12107,
+    12139, 12167, 12183, 12208, 12224, 12244, 12265, 12284, 12304, 12325, 12346, 12367,
+    12387, 12408, 12420, 12438, 12460, 12473, 12504, 12528, 12540, 12553, 12577, 12590,
+    12603, 12636, 12658, 12677, 12694, 12702, 12709, 12734, 12739, 12767, 12774, 12816,
+    12822, 12827, 12887, 12907, 12957, 12972, 12984, 12997, 13010, 13036, 13049, 13073,
+    13096, 13103, 13125, 13142, 13161, 13183, 13197, 13211, 13225, 13239, 13277, 13300,
+    13339, 13362, 13373, 13387, 13406, 13431, 13457, 13482, 13508, 13533, 13559, 13583,
+    13620, 13640, 13670, 13701, 13734, 13780, 13799, 13814, 13832, 13848, 13865, 13894,
+    13911, 13928, 13946, 13962, 13979, 14007, 14024, 14041, 14064, 14074, 14093, 14126,
+    14148, 14167, 14200, 14231, 14257, 14299, 14304, 14323, 14342, 14368, 14393, 14425,
+    14431, 14449, 14476, 14517, 14534, 14545, 14556, 14573, 14589, 14618, 14635, 14664,
+    14681, 14715, 14731, 14747, 14760, 14789, 14807, 14815, 14823, 14831, 14839, 14847,
+    14855, 14863, 14871, 14879
+};
+
+static const uint8_t HMS_DB_MESSAGE_TEXT[] = {
+    0x81, 0x62, 0x80, 0xE3, 0x4E, 0x83, 0xA1, 0x6E, 0x80, 0x8A, 0x68, 0x00, 0x81, 0xC0, 0x80, 0xE7,
+    0x81, 0xCB, 0x0A, 0x80, 0x9D, 0x00, 0x02, 0x5F, 0x00, 0x81, 0x19, 0x81, 0x2E, 0x80, 0xE3, 0x1F,
+    0x7C, 0x80, 0xB0, 0x6E, 0x80, 0xB8, 0x0A, 0x81, 0xE0, 0x73, 0x20, 0x82, 0x83, 0x82, 0x31, 0x80,
+    0xCA, 0x84, 0x1A, 0x80, 0xE3, 0x80, 0xB6, 0x82, 0x07, 0x81, 0x4E, 0x80, 0x9A, 0x07, 0x80, 0x94,
+    0x82, 0x3A, 0x68, 0x81, 0xDC, 0x82, 0x42, 0x80, 0xE3, 0x80, 0xB6, 0x82, 0x07, 0x81, 0x4E, 0x0A,
+    0x6C, 0x00, 0x80, 0xC0, 0x80, 0xE3, 0x80, 0xB6, 0x82, 0x32, 0x81, 0x4E, 0x80, 0x9A, 0x07, 0x80,
+    0x94, 0x82, 0x3A, 0x68, 0x81, 0xDC, 0x82, 0x42, 0x80, 0xE3, 0x80, 0xB6, 0x82, 0x32, 0x81, 0x4E,
+    0x0A, 0x6C, 0x00, 0x80, 0xC0, 0x4F, 0x77, 0x0C, 0x04, 0x29, 0x0A, 0x14, 0x27, 0x00, 0x39, 0x06,
+    0x02, 0x04, 0x1C, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58, 0x5C, 0x4F, 0x80, 0xBA, 0x08, 0x80, 0x99,
+    0x80, 0xEA, 0x16, 0x80, 0xA7, 0x81, 0x32, 0x03, 0x80, 0xCC, 0x08, 0x0D, 0x2A, 0x39, 0x06, 0x00,
+    0x80, 0xB9, 0x1B, 0x00, 0x02, 0x81, 0x2A, 0x2A, 0x0E, 0x00, 0x83, 0x99, 0x4F, 0x02, 0x07, 0x0F,
+    0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x02, 0x80, 0xCF, 0x00, 0x4F, 0x0B, 0x43, 0x00, 0x58, 0x5C, 0x4F,
+    0x02, 0x81, 0xA2, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x02, 0x80, 0xCF, 0x00, 0x75, 0x4F, 0x83, 0xEE,
+    0x4F, 0x02, 0x81, 0xA2, 0x28, 0x0A, 0x82, 0x38, 0x0D, 0x1F, 0x02, 0x80, 0xCF, 0x4F, 0x0B, 0x43,
+    0x00, 0x58, 0x5C, 0x4F, 0x04, 0x81, 0xF1, 0x09, 0x53, 0x02, 0x5F, 0x39, 0x81, 0x3E, 0x10, 0x4E,
+    0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x10, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E,
+    0x01, 0x48, 0x80, 0x83, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x10, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01,
+    0x48, 0x80, 0x93, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x10, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48,
+    0x80, 0xC8, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x10, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x81,
+    0x1D, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x10, 0x17, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F,
+    0x35, 0x10, 0x17, 0x33, 0x80, 0x88, 0x04, 0x1E, 0x06, 0x00, 0x80, 0x85, 0x59, 0x78, 0x07, 0x2C,
+    0x35, 0x10, 0x17, 0x02, 0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08, 0x00, 0x48, 0x54, 0x00,
+    0x75, 0x16, 0x10, 0x17, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09,
+    0x14, 0x08, 0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63, 0x10, 0x17, 0x02, 0x07, 0x0F, 0x47,
+    0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x56, 0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00,
+    0x37, 0x41, 0x10, 0x17, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x10, 0x17, 0x02,
+    0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02, 0x04, 0x80, 0x8B, 0x10, 0x17, 0x02, 0x07, 0x0F,
+    0x28, 0x80, 0x84, 0x00, 0x22, 0x44, 0x09, 0x80, 0x82, 0x10, 0x17, 0x02, 0x07, 0x0F, 0x74, 0x09,
+    0x2B, 0x0D, 0x1F, 0x16, 0x10, 0x17, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80, 0x81, 0x10,
+    0x17, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37, 0x41, 0x10, 0x17, 0x02, 0x05, 0x03, 0x21, 0x06,
+    0x1C, 0x10, 0x17, 0x04, 0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x10, 0x17, 0x04, 0x40, 0x09, 0x53,
+    0x0D, 0x1F, 0x16, 0x10, 0x81, 0x24, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F, 0x10, 0x18, 0x33, 0x25,
+    0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x10, 0x18, 0x33, 0x80, 0x88, 0x04, 0x1E, 0x06, 0x00,
+    0x80, 0x85, 0x59, 0x78, 0x07, 0x2C, 0x35, 0x10, 0x18, 0x02, 0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80,
+    0x91, 0x08, 0x00, 0x48, 0x54, 0x00, 0x75, 0x16, 0x10, 0x18, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F,
+    0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x08, 0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63,
+    0x10, 0x18, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x56,
+    0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41, 0x10, 0x18, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B,
+    0x0D, 0x1F, 0x16, 0x10, 0x18, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02, 0x04, 0x80,
+    0x8B, 0x10, 0x18, 0x02, 0x07, 0x0F, 0x28, 0x80, 0x84, 0x00, 0x22, 0x44, 0x09, 0x80, 0x82, 0x10,
+    0x18, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x10, 0x18, 0x02, 0x05, 0x03, 0x1E,
+    0x0E, 0x00, 0x5A, 0x80, 0x81, 0x10, 0x18, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37, 0x41, 0x10,
+    0x18, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x10, 0x18, 0x04, 0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16,
+    0x10, 0x18, 0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x10, 0x81, 0x25, 0x02, 0x05, 0x03, 0x1E,
+    0x0E, 0x6F, 0x10, 0x19, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x10, 0x19, 0x33,
+    0x80, 0x88, 0x04, 0x1E, 0x06, 0x00, 0x80, 0x85, 0x59, 0x78, 0x07, 0x2C, 0x35, 0x10, 0x19, 0x02,
+    0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08, 0x00, 0x48, 0x54, 0x00, 0x75, 0x16, 0x10, 0x19,
+    0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x08, 0x62, 0x27,
+    0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63, 0x10, 0x19, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22,
+    0x02, 0x49, 0x42, 0x09, 0x14, 0x56, 0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41, 0x10, 0x19,
+    0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x10, 0x19, 0x02, 0x07, 0x0F, 0x28, 0x0A,
+    0x7A, 0x64, 0x22, 0x02, 0x04, 0x80, 0x8B, 0x10, 0x19, 0x02, 0x07, 0x0F, 0x28, 0x80, 0x84, 0x00,
+    0x22, 0x44, 0x09, 0x80, 0x82, 0x10, 0x19, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16,
+    0x10, 0x19, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80, 0x81, 0x10, 0x19, 0x02, 0x05, 0x03,
+    0x1E, 0x0E, 0x00, 0x37, 0x41, 0x10, 0x19, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x10, 0x19, 0x04,
+    0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x10, 0x19, 0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x10,
+    0x81, 0x26, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F, 0x10, 0x1A, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B,
+    0x0D, 0x7F, 0x35, 0x10, 0x1A, 0x33, 0x80, 0x88, 0x04, 0x1E, 0x06, 0x00, 0x80, 0x85, 0x59, 0x78,
+    0x07, 0x2C, 0x35, 0x10, 0x1A, 0x02, 0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08, 0x00, 0x48,
+    0x54, 0x00, 0x75, 0x16, 0x10, 0x1A, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49,
+    0x42, 0x09, 0x14, 0x08, 0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63, 0x10, 0x1A, 0x02, 0x07,
+    0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x56, 0x00, 0x02, 0x04, 0x2A,
+    0x0E, 0x00, 0x37, 0x41, 0x10, 0x1A, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x10,
+    0x1A, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02, 0x04, 0x80, 0x8B, 0x10, 0x1A, 0x02,
+    0x07, 0x0F, 0x28, 0x80, 0x84, 0x00, 0x22, 0x44, 0x09, 0x80, 0x82, 0x10, 0x1A, 0x02, 0x07, 0x0F,
+    0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x10, 0x1A, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80,
+    0x81, 0x10, 0x1A, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37, 0x41, 0x10, 0x1A, 0x02, 0x05, 0x03,
+    0x21, 0x06, 0x1C, 0x10, 0x1A, 0x04, 0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x10, 0x1A, 0x04, 0x40,
+    0x09, 0x53, 0x0D, 0x1F, 0x16, 0x10, 0x81, 0x27, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F, 0x10, 0x80,
+    0xDA, 0x04, 0x71, 0x09, 0x14, 0x00, 0x80, 0x9E, 0x81, 0x2C, 0x11, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E,
+    0x01, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x11, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x80, 0x83,
+    0x02, 0x6B, 0x05, 0x03, 0x23, 0x11, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x80, 0x93, 0x02,
+    0x6B, 0x05, 0x03, 0x23, 0x11, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x80, 0xC8, 0x02, 0x6B,
+    0x05, 0x03, 0x23, 0x11, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x81, 0x1D, 0x02, 0x6B, 0x05,
+    0x03, 0x23, 0x11, 0x17, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x11, 0x17, 0x33,
+    0x80, 0x88, 0x04, 0x1E, 0x06, 0x00, 0x80, 0x85, 0x59, 0x78, 0x07, 0x2C, 0x35, 0x11, 0x17, 0x02,
+    0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08, 0x00, 0x48, 0x54, 0x00, 0x75, 0x16, 0x11, 0x17,
+    0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x08, 0x62, 0x27,
+    0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63, 0x11, 0x17, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22,
+    0x02, 0x49, 0x42, 0x09, 0x14, 0x56, 0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41, 0x11, 0x17,
+    0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x11, 0x17, 0x02, 0x07, 0x0F, 0x28, 0x0A,
+    0x7A, 0x64, 0x22, 0x02, 0x04, 0x80, 0x8B, 0x11, 0x17, 0x02, 0x07, 0x0F, 0x28, 0x80, 0x84, 0x00,
+    0x22, 0x44, 0x09, 0x80, 0x82, 0x11, 0x17, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16,
+    0x11, 0x17, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80, 0x81, 0x11, 0x17, 0x02, 0x05, 0x03,
+    0x1E, 0x0E, 0x00, 0x37, 0x41, 0x11, 0x17, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x11, 0x17, 0x04,
+    0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x11, 0x17, 0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x11,
+    0x81, 0x24, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F, 0x11, 0x18, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B,
+    0x0D, 0x7F, 0x35, 0x11, 0x18, 0x33, 0x80, 0x88, 0x04, 0x1E, 0x06, 0x00, 0x80, 0x85, 0x59, 0x78,
+    0x07, 0x2C, 0x35, 0x11, 0x18, 0x02, 0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08, 0x00, 0x48,
+    0x54, 0x00, 0x75, 0x16, 0x11, 0x18, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49,
+    0x42, 0x09, 0x14, 0x08, 0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63, 0x11, 0x18, 0x02, 0x07,
+    0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x56, 0x00, 0x02, 0x04, 0x2A,
+    0x0E, 0x00, 0x37, 0x41, 0x11, 0x18, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x11,
+    0x18, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02, 0x04, 0x80, 0x8B, 0x11, 0x18, 0x02,
+    0x07, 0x0F, 0x28, 0x80, 0x84, 0x00, 0x22, 0x44, 0x09, 0x80, 0x82, 0x11, 0x18, 0x02, 0x07, 0x0F,
+    0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x11, 0x18, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80,
+    0x81, 0x11, 0x18, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37, 0x41, 0x11, 0x18, 0x02, 0x05, 0x03,
+    0x21, 0x06, 0x1C, 0x11, 0x18, 0x04, 0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x11, 0x18, 0x04, 0x40,
+    0x09, 0x53, 0x0D, 0x1F, 0x16, 0x11, 0x81, 0x25, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F, 0x11, 0x19,
+    0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x11, 0x19, 0x33, 0x80, 0x88, 0x04, 0x1E,
+    0x06, 0x00, 0x80, 0x85, 0x59, 0x78, 0x07, 0x2C, 0x35, 0x11, 0x19, 0x02, 0x07, 0x0F, 0x55, 0x0B,
+    0x7D, 0x80, 0x91, 0x08, 0x00, 0x48, 0x54, 0x00, 0x75, 0x16, 0x11, 0x19, 0x02, 0x07, 0x0F, 0x47,
+    0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x08, 0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E,
+    0x00, 0x63, 0x11, 0x19, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09,
+    0x14, 0x56, 0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41, 0x11, 0x19, 0x02, 0x07, 0x0F, 0x28,
+    0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x11, 0x19, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02,
+    0x04, 0x80, 0x8B, 0x11, 0x19, 0x02, 0x07, 0x0F, 0x28, 0x80, 0x84, 0x00, 0x22, 0x44, 0x09, 0x80,
+    0x82, 0x11, 0x19, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x11, 0x19, 0x02, 0x05,
+    0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80, 0x81, 0x11, 0x19, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37,
+    0x41, 0x11, 0x19, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x11, 0x19, 0x04, 0x40, 0x09, 0x2B, 0x0D,
+    0x1F, 0x16, 0x11, 0x19, 0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x11, 0x81, 0x26, 0x02, 0x05,
+    0x03, 0x1E, 0x0E, 0x6F, 0x11, 0x1A, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x11,
+    0x1A, 0x33, 0x80, 0x88, 0x04, 0x1E, 0x06, 0x00, 0x80, 0x85, 0x59, 0x78, 0x07, 0x2C, 0x35, 0x11,
+    0x1A, 0x02, 0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08, 0x00, 0x48, 0x54, 0x00, 0x75, 0x16,
+    0x11, 0x1A, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x08,
+    0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63, 0x11, 0x1A, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F,
+    0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x56, 0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41,
+    0x11, 0x1A, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x11, 0x1A, 0x02, 0x07, 0x0F,
+    0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02, 0x04, 0x80, 0x8B, 0x11, 0x1A, 0x02, 0x07, 0x0F, 0x28, 0x80,
+    0x84, 0x00, 0x22, 0x44, 0x09, 0x80, 0x82, 0x11, 0x1A, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D,
+    0x1F, 0x16, 0x11, 0x1A, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80, 0x81, 0x11, 0x1A, 0x02,
+    0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37, 0x41, 0x11, 0x1A, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x11,
+    0x1A, 0x04, 0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x11, 0x1A, 0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F,
+    0x16, 0x11, 0x81, 0x27, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F, 0x11, 0x80, 0xDA, 0x04, 0x71, 0x09,
+    0x14, 0x00, 0x80, 0x9E, 0x81, 0x2C, 0x12, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x02, 0x6B, 0x05,
+    0x03, 0x23, 0x12, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x80, 0x83, 0x02, 0x6B, 0x05, 0x03,
+    0x23, 0x12, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x80, 0x93, 0x02, 0x6B, 0x05, 0x03, 0x23,
+    0x12, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x80, 0xC8, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x12,
+    0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x81, 0x1D, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x12, 0x17,
+    0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x12, 0x17, 0x33, 0x80, 0x88, 0x04, 0x1E,
+    0x06, 0x00, 0x80, 0x85, 0x59, 0x78, 0x07, 0x2C, 0x35, 0x12, 0x17, 0x02, 0x07, 0x0F, 0x55, 0x0B,
+    0x7D, 0x80, 0x91, 0x08, 0x00, 0x48, 0x54, 0x00, 0x75, 0x16, 0x12, 0x17, 0x02, 0x07, 0x0F, 0x47,
+    0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x08, 0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E,
+    0x00, 0x63, 0x12, 0x17, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09,
+    0x14, 0x56, 0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41, 0x12, 0x17, 0x02, 0x07, 0x0F, 0x28,
+    0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x12, 0x17, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02,
+    0x04, 0x80, 0x8B, 0x12, 0x17, 0x02, 0x07, 0x0F, 0x28, 0x80, 0x84, 0x00, 0x22, 0x44, 0x09, 0x80,
+    0x82, 0x12, 0x17, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x12, 0x17, 0x02, 0x05,
+    0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80, 0x81, 0x12, 0x17, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37,
+    0x41, 0x12, 0x17, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x12, 0x17, 0x04, 0x40, 0x09, 0x2B, 0x0D,
+    0x1F, 0x16, 0x12, 0x17, 0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x12, 0x81, 0x24, 0x02, 0x05,
+    0x03, 0x1E, 0x0E, 0x6F, 0x12, 0x18, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x12,
+    0x18, 0x33, 0x80, 0x88, 0x04, 0x1E, 0x06, 0x00, 0x80, 0x85, 0x59, 0x78, 0x07, 0x2C, 0x35, 0x12,
+    0x18, 0x02, 0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08, 0x00, 0x48, 0x54, 0x00, 0x75, 0x16,
+    0x12, 0x18, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x08,
+    0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63, 0x12, 0x18, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F,
+    0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x56, 0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41,
+    0x12, 0x18, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x12, 0x18, 0x02, 0x07, 0x0F,
+    0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02, 0x04, 0x80, 0x8B, 0x12, 0x18, 0x02, 0x07, 0x0F, 0x28, 0x80,
+    0x84, 0x00, 0x22, 0x44, 0x09, 0x80, 0x82, 0x12, 0x18, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D,
+    0x1F, 0x16, 0x12, 0x18, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80, 0x81, 0x12, 0x18, 0x02,
+    0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37, 0x41, 0x12, 0x18, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x12,
+    0x18, 0x04, 0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x12, 0x18, 0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F,
+    0x16, 0x12, 0x81, 0x25, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F, 0x12, 0x19, 0x33, 0x25, 0x03, 0x67,
+    0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x12, 0x19, 0x33, 0x80, 0x88, 0x04, 0x1E, 0x06, 0x00, 0x80, 0x85,
+    0x59, 0x78, 0x07, 0x2C, 0x35, 0x12, 0x19, 0x02, 0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08,
+    0x00, 0x48, 0x54, 0x00, 0x75, 0x16, 0x12, 0x19, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22,
+    0x02, 0x49, 0x42, 0x09, 0x14, 0x08, 0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63, 0x12, 0x19,
+    0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x56, 0x00, 0x02,
+    0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41, 0x12, 0x19, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F,
+    0x16, 0x12, 0x19, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02, 0x04, 0x80, 0x8B, 0x12,
+    0x19, 0x02, 0x07, 0x0F, 0x28, 0x80, 0x84, 0x00, 0x22, 0x44, 0x09, 0x80, 0x82, 0x12, 0x19, 0x02,
+    0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x12, 0x19, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00,
+    0x5A, 0x80, 0x81, 0x12, 0x19, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37, 0x41, 0x12, 0x19, 0x02,
+    0x05, 0x03, 0x21, 0x06, 0x1C, 0x12, 0x19, 0x04, 0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x12, 0x19,
+    0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x12, 0x81, 0x26, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F,
+    0x12, 0x1A, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x12, 0x1A, 0x33, 0x80, 0x88,
+    0x04, 0x1E, 0x06, 0x00, 0x80, 0x85, 0x59, 0x78, 0x07, 0x2C, 0x35, 0x12, 0x1A, 0x02, 0x07, 0x0F,
+    0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08, 0x00, 0x48, 0x54, 0x00, 0x75, 0x16, 0x12, 0x1A, 0x02, 0x07,
+    0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x08, 0x62, 0x27, 0x02, 0x04,
+    0x2A, 0x0E, 0x00, 0x63, 0x12, 0x1A, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49,
+    0x42, 0x09, 0x14, 0x56, 0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41, 0x12, 0x1A, 0x02, 0x07,
+    0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x12, 0x1A, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64,
+    0x22, 0x02, 0x04, 0x80, 0x8B, 0x12, 0x1A, 0x02, 0x07, 0x0F, 0x28, 0x80, 0x84, 0x00, 0x22, 0x44,
+    0x09, 0x80, 0x82, 0x12, 0x1A, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x12, 0x1A,
+    0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80, 0x81, 0x12, 0x1A, 0x02, 0x05, 0x03, 0x1E, 0x0E,
+    0x00, 0x37, 0x41, 0x12, 0x1A, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x12, 0x1A, 0x04, 0x40, 0x09,
+    0x2B, 0x0D, 0x1F, 0x16, 0x12, 0x1A, 0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x12, 0x81, 0x27,
+    0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F, 0x12, 0x80, 0xDA, 0x04, 0x71, 0x09, 0x14, 0x00, 0x80, 0x9E,
+    0x81, 0x2C, 0x13, 0x4E, 0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x13, 0x4E,
+    0x3D, 0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x80, 0x83, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x13, 0x4E, 0x3D,
+    0x0B, 0x6A, 0x5E, 0x01, 0x48, 0x80, 0x93, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x13, 0x4E, 0x3D, 0x0B,
+    0x6A, 0x5E, 0x01, 0x48, 0x80, 0xC8, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x13, 0x4E, 0x3D, 0x0B, 0x6A,
+    0x5E, 0x01, 0x48, 0x81, 0x1D, 0x02, 0x6B, 0x05, 0x03, 0x23, 0x13, 0x17, 0x33, 0x25, 0x03, 0x67,
+    0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x13, 0x17, 0x33, 0x80, 0x88, 0x04, 0x1E, 0x06, 0x00, 0x80, 0x85,
+    0x59, 0x78, 0x07, 0x2C, 0x35, 0x13, 0x17, 0x02, 0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08,
+    0x00, 0x48, 0x54, 0x00, 0x75, 0x16, 0x13, 0x17, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22,
+    0x02, 0x49, 0x42, 0x09, 0x14, 0x08, 0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63, 0x13, 0x17,
+    0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x56, 0x00, 0x02,
+    0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41, 0x13, 0x17, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F,
+    0x16, 0x13, 0x17, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02, 0x04, 0x80, 0x8B, 0x13,
+    0x17, 0x02, 0x07, 0x0F, 0x28, 0x80, 0x84, 0x00, 0x22, 0x44, 0x09, 0x80, 0x82, 0x13, 0x17, 0x02,
+    0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x13, 0x17, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00,
+    0x5A, 0x80, 0x81, 0x13, 0x17, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37, 0x41, 0x13, 0x17, 0x02,
+    0x05, 0x03, 0x21, 0x06, 0x1C, 0x13, 0x17, 0x04, 0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x13, 0x17,
+    0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x13, 0x81, 0x24, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F,
+    0x13, 0x18, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x13, 0x18, 0x33, 0x80, 0x88,
+    0x04, 0x1E, 0x06, 0x00, 0x80, 0x85, 0x59, 0x78, 0x07, 0x2C, 0x35, 0x13, 0x18, 0x02, 0x07, 0x0F,
+    0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08, 0x00, 0x48, 0x54, 0x00, 0x75, 0x16, 0x13, 0x18, 0x02, 0x07,
+    0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x08, 0x62, 0x27, 0x02, 0x04,
+    0x2A, 0x0E, 0x00, 0x63, 0x13, 0x18, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49,
+    0x42, 0x09, 0x14, 0x56, 0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41, 0x13, 0x18, 0x02, 0x07,
+    0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x13, 0x18, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64,
+    0x22, 0x02, 0x04, 0x80, 0x8B, 0x13, 0x18, 0x02, 0x07, 0x0F, 0x28, 0x80, 0x84, 0x00, 0x22, 0x44,
+    0x09, 0x80, 0x82, 0x13, 0x18, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x13, 0x18,
+    0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80, 0x81, 0x13, 0x18, 0x02, 0x05, 0x03, 0x1E, 0x0E,
+    0x00, 0x37, 0x41, 0x13, 0x18, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x13, 0x18, 0x04, 0x40, 0x09,
+    0x2B, 0x0D, 0x1F, 0x16, 0x13, 0x18, 0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x13, 0x81, 0x25,
+    0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F, 0x13, 0x19, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F,
+    0x35, 0x13, 0x19, 0x33, 0x80, 0x88, 0x04, 0x1E, 0x06, 0x00, 0x80, 0x85, 0x59, 0x78, 0x07, 0x2C,
+    0x35, 0x13, 0x19, 0x02, 0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80, 0x91, 0x08, 0x00, 0x48, 0x54, 0x00,
+    0x75, 0x16, 0x13, 0x19, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09,
+    0x14, 0x08, 0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63, 0x13, 0x19, 0x02, 0x07, 0x0F, 0x47,
+    0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x56, 0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00,
+    0x37, 0x41, 0x13, 0x19, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B, 0x0D, 0x1F, 0x16, 0x13, 0x19, 0x02,
+    0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02, 0x04, 0x80, 0x8B, 0x13, 0x19, 0x02, 0x07, 0x0F,
+    0x28, 0x80, 0x84, 0x00, 0x22, 0x44, 0x09, 0x80, 0x82, 0x13, 0x19, 0x02, 0x07, 0x0F, 0x74, 0x09,
+    0x2B, 0x0D, 0x1F, 0x16, 0x13, 0x19, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x5A, 0x80, 0x81, 0x13,
+    0x19, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37, 0x41, 0x13, 0x19, 0x02, 0x05, 0x03, 0x21, 0x06,
+    0x1C, 0x13, 0x19, 0x04, 0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x13, 0x19, 0x04, 0x40, 0x09, 0x53,
+    0x0D, 0x1F, 0x16, 0x13, 0x81, 0x26, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x6F, 0x13, 0x1A, 0x33, 0x25,
+    0x03, 0x67, 0x50, 0x1B, 0x0D, 0x7F, 0x35, 0x13, 0x1A, 0x33, 0x80, 0x88, 0x04, 0x1E, 0x06, 0x00,
+    0x80, 0x85, 0x59, 0x78, 0x07, 0x2C, 0x35, 0x13, 0x1A, 0x02, 0x07, 0x0F, 0x55, 0x0B, 0x7D, 0x80,
+    0x91, 0x08, 0x00, 0x48, 0x54, 0x00, 0x75, 0x16, 0x13, 0x1A, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F,
+    0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x08, 0x62, 0x27, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x63,
+    0x13, 0x1A, 0x02, 0x07, 0x0F, 0x47, 0x0B, 0x3F, 0x00, 0x22, 0x02, 0x49, 0x42, 0x09, 0x14, 0x56,
+    0x00, 0x02, 0x04, 0x2A, 0x0E, 0x00, 0x37, 0x41, 0x13, 0x1A, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x2B,
+    0x0D, 0x1F, 0x16, 0x13, 0x1A, 0x02, 0x07, 0x0F, 0x28, 0x0A, 0x7A, 0x64, 0x22, 0x02, 0x04, 0x80,
+    0x8B, 0x13, 0x1A, 0x02, 0x07, 0x0F, 0x28, 0x80, 0x84, 0x00, 0x22, 0x44, 0x09, 0x80, 0x82, 0x13,
+    0x1A, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x13, 0x1A, 0x02, 0x05, 0x03, 0x1E,
+    0x0E, 0x00, 0x5A, 0x80, 0x81, 0x13, 0x1A, 0x02, 0x05, 0x03, 0x1E, 0x0E, 0x00, 0x37, 0x41, 0x13,
+    0x1A, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x13, 0x1A, 0x04, 0x40, 0x09, 0x2B, 0x0D, 0x1F, 0x16,
+    0x13, 0x1A, 0x04, 0x40, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x13, 0x81, 0x27, 0x02, 0x05, 0x03, 0x1E,
+    0x0E, 0x6F, 0x13, 0x80, 0xDA, 0x04, 0x71, 0x09, 0x14, 0x00, 0x80, 0x9E, 0x81, 0x2C, 0x82, 0x7B,
+    0x82, 0xC7, 0x81, 0x06, 0x80, 0xB8, 0x0A, 0x6D, 0x08, 0x6C, 0x00, 0x80, 0xF7, 0x80, 0xFC, 0x82,
+    0xC2, 0x83, 0x87, 0x81, 0xF5, 0x00, 0x80, 0xC2, 0x81, 0xA1, 0x1B, 0x00, 0x83, 0x3E, 0x00, 0x80,
+    0xC2, 0x83, 0x75, 0x05, 0x03, 0x80, 0x95, 0x80, 0xFC, 0x81, 0x38, 0x81, 0x36, 0x6E, 0x80, 0x8A,
+    0x20, 0x66, 0x15, 0x82, 0x70, 0x01, 0x4B, 0x80, 0x98, 0x05, 0x26, 0x81, 0xB6, 0x81, 0xAC, 0x81,
+    0x50, 0x00, 0x81, 0x8B, 0x80, 0xFC, 0x81, 0x38, 0x81, 0x36, 0x6E, 0x80, 0x8A, 0x20, 0x66, 0x15,
+    0x82, 0x73, 0x01, 0x4B, 0x80, 0x98, 0x05, 0x26, 0x81, 0xB6, 0x81, 0xAC, 0x81, 0x50, 0x00, 0x81,
+    0x8B, 0x80, 0xFC, 0x81, 0x38, 0x81, 0x36, 0x6E, 0x80, 0x8A, 0x20, 0x66, 0x15, 0x82, 0x74, 0x01,
+    0x4B, 0x80, 0x98, 0x05, 0x26, 0x81, 0xB6, 0x81, 0xAC, 0x81, 0x50, 0x00, 0x81, 0x8B, 0x80, 0xFC,
+    0x81, 0x91, 0x83, 0x86, 0x81, 0x1B, 0x80, 0xC2, 0x00, 0x4B, 0x83, 0xAE, 0x82, 0xB9, 0x81, 0xE9,
+    0x84, 0x1D, 0x65, 0x83, 0xB2, 0x09, 0x81, 0x54, 0x08, 0x00, 0x84, 0x27, 0x08, 0x84, 0x0C, 0x82,
+    0x7D, 0x81, 0xB4, 0x28, 0x0A, 0x81, 0x48, 0x81, 0x5B, 0x82, 0x5C, 0x65, 0x83, 0x9F, 0x06, 0x82,
+    0xA6, 0x07, 0x80, 0xBD, 0x08, 0x00, 0x81, 0x90, 0x0B, 0x83, 0x1C, 0x82, 0x5C, 0x00, 0x81, 0xC3,
+    0x82, 0xB2, 0x82, 0x96, 0x81, 0x64, 0x04, 0x83, 0xDC, 0x0E, 0x00, 0x83, 0x34, 0x81, 0xF5, 0x00,
+    0x80, 0xBE, 0x83, 0x8E, 0x81, 0xC4, 0x81, 0x04, 0x82, 0x0F, 0x83, 0x94, 0x81, 0xFB, 0x81, 0x62,
+    0x09, 0x6D, 0x80, 0xA0, 0x81, 0xC4, 0x4A, 0x0A, 0x82, 0x44, 0x06, 0x6C, 0x00, 0x61, 0x0B, 0x83,
+    0xD9, 0x82, 0x80, 0x80, 0x98, 0x82, 0x22, 0x81, 0x98, 0x6E, 0x2F, 0x82, 0x02, 0x70, 0x81, 0x31,
+    0x05, 0x03, 0x1D, 0x82, 0x50, 0x80, 0x9B, 0x80, 0x96, 0x80, 0x97, 0x00, 0x51, 0x08, 0x83, 0x40,
+    0x81, 0x31, 0x27, 0x00, 0x83, 0x3A, 0x0E, 0x51, 0x04, 0x83, 0x7F, 0x70, 0x80, 0xBA, 0x08, 0x83,
+    0xBC, 0x00, 0x83, 0x0A, 0x80, 0xBC, 0x01, 0x81, 0x47, 0x81, 0xBB, 0x83, 0xF9, 0x82, 0x64, 0x5B,
+    0x00, 0x51, 0x80, 0xBC, 0x70, 0x52, 0x80, 0x83, 0x80, 0xBA, 0x08, 0x82, 0x45, 0x08, 0x82, 0x58,
+    0x80, 0xBC, 0x70, 0x52, 0x80, 0x93, 0x80, 0xBA, 0x08, 0x82, 0x45, 0x08, 0x82, 0x58, 0x80, 0xBC,
+    0x70, 0x80, 0xC2, 0x4A, 0x01, 0x51, 0x52, 0x05, 0x03, 0x83, 0x27, 0x08, 0x82, 0xE1, 0x81, 0x8E,
+    0x82, 0xD2, 0x70, 0x80, 0xC2, 0x4A, 0x01, 0x51, 0x05, 0x2F, 0x03, 0x83, 0x1A, 0x06, 0x00, 0x82,
+    0xD6, 0x24, 0x05, 0x03, 0x1D, 0x81, 0x94, 0x06, 0x00, 0x82, 0x09, 0x83, 0x12, 0x84, 0x1F, 0x1B,
+    0x00, 0x80, 0xE0, 0x81, 0x59, 0x05, 0x03, 0x82, 0xE0, 0x70, 0x80, 0xC2, 0x4A, 0x01, 0x3D, 0x1B,
+    0x00, 0x80, 0xC2, 0x80, 0xCD, 0x04, 0x1D, 0x80, 0xDD, 0x70, 0x80, 0xC2, 0x4A, 0x01, 0x24, 0x1B,
+    0x80, 0xE0, 0x81, 0x59, 0x05, 0x03, 0x1D, 0x81, 0x8C, 0x70, 0x80, 0xC2, 0x4A, 0x01, 0x81, 0x5C,
+    0x81, 0x12, 0x04, 0x1D, 0x81, 0x8C, 0x70, 0x24, 0x04, 0x3E, 0x01, 0x51, 0x80, 0xF4, 0x24, 0x15,
+    0x80, 0xB2, 0x00, 0x81, 0x28, 0x82, 0x11, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x70, 0x24, 0x04,
+    0x3E, 0x01, 0x51, 0x80, 0xF4, 0x24, 0x15, 0x80, 0xB2, 0x00, 0x81, 0x28, 0x82, 0x11, 0x05, 0x26,
+    0x2C, 0x80, 0x97, 0x57, 0x70, 0x24, 0x04, 0x3E, 0x01, 0x51, 0x80, 0xF4, 0x24, 0x15, 0x80, 0xB2,
+    0x00, 0x81, 0x28, 0x82, 0x30, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x70, 0x24, 0x04, 0x3E, 0x01,
+    0x51, 0x80, 0xF4, 0x24, 0x15, 0x80, 0xB2, 0x00, 0x81, 0x28, 0x82, 0x30, 0x05, 0x26, 0x2C, 0x80,
+    0x97, 0x57, 0x70, 0x24, 0x04, 0x3E, 0x01, 0x51, 0x80, 0xF4, 0x24, 0x15, 0x05, 0x26, 0x0D, 0x80,
+    0xA4, 0x57, 0x70, 0x24, 0x04, 0x3E, 0x01, 0x51, 0x80, 0xF4, 0x24, 0x15, 0x05, 0x26, 0x2C, 0x80,
+    0x97, 0x57, 0x70, 0x24, 0x04, 0x3E, 0x01, 0x24, 0x15, 0x80, 0xB2, 0x80, 0xE0, 0x81, 0x59, 0x05,
+    0x26, 0x2C, 0x80, 0x97, 0x57, 0x70, 0x24, 0x04, 0x3E, 0x01, 0x24, 0x15, 0x80, 0xB2, 0x00, 0x80,
+    0xE0, 0x81, 0x59, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x70, 0x24, 0x81, 0x95, 0x70, 0x24, 0x83,
+    0xE8, 0x81, 0xB9, 0x83, 0x1E, 0x00, 0x83, 0x5F, 0x00, 0x82, 0xE3, 0x81, 0xB9, 0x81, 0xBB, 0x03,
+    0x83, 0xE7, 0x82, 0x87, 0x81, 0x4C, 0x82, 0x89, 0x82, 0x69, 0x27, 0x02, 0x6E, 0x81, 0xFA, 0x83,
+    0x8F, 0x82, 0x37, 0x02, 0x81, 0x89, 0x82, 0x4F, 0x0B, 0x43, 0x82, 0x6D, 0x82, 0x88, 0x00, 0x02,
+    0x81, 0x44, 0x1B, 0x81, 0xDA, 0x4F, 0x83, 0xEF, 0x09, 0x80, 0x82, 0x80, 0xD4, 0x80, 0xBD, 0x81,
+    0xFB, 0x80, 0xFB, 0x05, 0x03, 0x80, 0xA9, 0x68, 0x80, 0xAC, 0x81, 0x40, 0x80, 0xCC, 0x08, 0x82,
+    0x16, 0x80, 0x9B, 0x80, 0x96, 0x6D, 0x80, 0xF6, 0x00, 0x61, 0x80, 0xEE, 0x08, 0x00, 0x80, 0xAE,
+    0x80, 0xCA, 0x80, 0x9F, 0x6D, 0x80, 0xA0, 0x80, 0xD4, 0x80, 0xBD, 0x4A, 0x80, 0xE6, 0x82, 0x39,
+    0x82, 0x0E, 0x80, 0xAC, 0x81, 0x40, 0x80, 0xA9, 0x68, 0x82, 0x15, 0x82, 0x0D, 0x08, 0x80, 0xBD,
+    0x00, 0x81, 0x90, 0x06, 0x80, 0xAE, 0x81, 0xFF, 0x81, 0x04, 0x82, 0x43, 0x80, 0x9B, 0x80, 0x96,
+    0x6D, 0x80, 0xF6, 0x00, 0x61, 0x80, 0xEE, 0x08, 0x00, 0x80, 0xAE, 0x06, 0x81, 0xE4, 0x00, 0x80,
+    0xAE, 0x81, 0x04, 0x0B, 0x81, 0x17, 0x6D, 0x80, 0xA0, 0x80, 0xD4, 0x80, 0xBD, 0x4A, 0x80, 0xE6,
+    0x82, 0x39, 0x82, 0x0E, 0x80, 0xAC, 0x81, 0x40, 0x80, 0xA9, 0x68, 0x82, 0x15, 0x82, 0x0D, 0x08,
+    0x80, 0xBD, 0x00, 0x81, 0x90, 0x06, 0x80, 0xAE, 0x81, 0xFF, 0x81, 0x04, 0x82, 0x43, 0x80, 0x9B,
+    0x80, 0x96, 0x6D, 0x80, 0xF6, 0x00, 0x61, 0x80, 0xEE, 0x08, 0x00, 0x80, 0xAE, 0x06, 0x81, 0xE4,
+    0x00, 0x80, 0xAE, 0x81, 0x04, 0x80, 0xCA, 0x80, 0x9F, 0x6D, 0x80, 0xA0, 0x80, 0xD4, 0x80, 0xBD,
+    0x81, 0x84, 0x80, 0xA5, 0x05, 0x03, 0x80, 0xA9, 0x68, 0x80, 0xAC, 0x81, 0x40, 0x80, 0xCC, 0x08,
+    0x82, 0x16, 0x80, 0x9B, 0x80, 0x96, 0x6D, 0x80, 0xF6, 0x00, 0x61, 0x80, 0xEE, 0x08, 0x00, 0x80,
+    0xAE, 0x80, 0xCA, 0x80, 0x9F, 0x6D, 0x80, 0xA0, 0x80, 0xD4, 0x80, 0xBD, 0x04, 0x82, 0x3C, 0x7B,
+    0x80, 0x9F, 0x26, 0x81, 0xB7, 0x81, 0x4B, 0x81, 0xB5, 0x0B, 0x80, 0x86, 0x80, 0xD2, 0x81, 0x85,
+    0x09, 0x80, 0xF0, 0x81, 0x7D, 0x81, 0xA8, 0x80, 0xD4, 0x80, 0xBD, 0x82, 0x3C, 0x7B, 0x80, 0x9F,
+    0x26, 0x81, 0xB7, 0x81, 0x4B, 0x81, 0xB5, 0x0B, 0x80, 0x86, 0x80, 0xD2, 0x81, 0x85, 0x09, 0x80,
+    0xF0, 0x81, 0x7D, 0x81, 0xA8, 0x80, 0xD4, 0x83, 0xD3, 0x04, 0x83, 0x54, 0x7B, 0x80, 0x9F, 0x26,
+    0x81, 0xB7, 0x81, 0x4B, 0x81, 0xB5, 0x0B, 0x80, 0x86, 0x80, 0xD2, 0x81, 0x85, 0x09, 0x80, 0xF0,
+    0x81, 0x7D, 0x81, 0xA8, 0x82, 0x8C, 0x00, 0x02, 0x4A, 0x0A, 0x14, 0x08, 0x62, 0x27, 0x00, 0x80,
+    0xCB, 0x04, 0x1C, 0x81, 0x23, 0x08, 0x00, 0x81, 0x1E, 0x5B, 0x81, 0xAB, 0x82, 0x8E, 0x82, 0x5E,
+    0x81, 0x0C, 0x00, 0x83, 0xE5, 0x83, 0xA9, 0x04, 0x71, 0x00, 0x83, 0xF0, 0x80, 0xB6, 0x05, 0x03,
+    0x23, 0x82, 0x8F, 0x80, 0xA8, 0x80, 0x98, 0x04, 0x2F, 0x00, 0x75, 0x81, 0x74, 0x00, 0x82, 0x95,
+    0x81, 0x88, 0x0A, 0x81, 0x6F, 0x83, 0xED, 0x80, 0xF8, 0x06, 0x81, 0x61, 0x00, 0x82, 0xFD, 0x83,
+    0xA7, 0x81, 0x65, 0x81, 0x35, 0x80, 0xBE, 0x04, 0x0E, 0x82, 0x35, 0x0B, 0x00, 0x80, 0xFD, 0x81,
+    0x03, 0x25, 0x03, 0x83, 0x11, 0x20, 0x00, 0x83, 0xDF, 0x80, 0x9B, 0x80, 0x96, 0x7A, 0x5B, 0x00,
+    0x80, 0xBE, 0x08, 0x83, 0x2E, 0x06, 0x82, 0xC5, 0x00, 0x80, 0xDB, 0x81, 0x35, 0x80, 0xBE, 0x81,
+    0xA1, 0x0E, 0x00, 0x82, 0x7A, 0x0B, 0x82, 0x44, 0x83, 0xDE, 0x00, 0x80, 0xFD, 0x81, 0x03, 0x20,
+    0x00, 0x81, 0x57, 0x5B, 0x81, 0xDE, 0x81, 0x65, 0x81, 0x92, 0x81, 0x84, 0x09, 0x14, 0x65, 0x81,
+    0x6E, 0x82, 0x10, 0x81, 0x65, 0x81, 0x92, 0x07, 0x83, 0x22, 0x09, 0x6D, 0x08, 0x82, 0xDE, 0x80,
+    0xA0, 0x82, 0x90, 0x84, 0x09, 0x84, 0x07, 0x81, 0x49, 0x82, 0x1B, 0x08, 0x83, 0x07, 0x0A, 0x81,
+    0xF8, 0x73, 0x81, 0x74, 0x83, 0x7D, 0x82, 0x91, 0x80, 0xEC, 0x83, 0x28, 0x81, 0x66, 0x81, 0x36,
+    0x6E, 0x80, 0x8A, 0x20, 0x00, 0x4B, 0x82, 0xC6, 0x83, 0xE3, 0x01, 0x15, 0x80, 0xAF, 0x81, 0xBC,
+    0x05, 0x2F, 0x03, 0x83, 0x31, 0x81, 0x66, 0x02, 0x07, 0x0F, 0x74, 0x09, 0x53, 0x0D, 0x1F, 0x16,
+    0x81, 0x66, 0x02, 0x04, 0x83, 0x72, 0x09, 0x53, 0x0D, 0x1F, 0x16, 0x82, 0x92, 0x02, 0x4A, 0x01,
+    0x32, 0x81, 0x49, 0x03, 0x80, 0xED, 0x30, 0x08, 0x81, 0xE0, 0x7C, 0x81, 0xC9, 0x0A, 0x81, 0x48,
+    0x81, 0x5B, 0x00, 0x81, 0x02, 0x82, 0xED, 0x04, 0x80, 0x9D, 0x0B, 0x2F, 0x83, 0x85, 0x0B, 0x0F,
+    0x81, 0x47, 0x81, 0x02, 0x80, 0xA0, 0x30, 0x08, 0x14, 0x00, 0x02, 0x81, 0x44, 0x0E, 0x00, 0x37,
+    0x82, 0x08, 0x09, 0x43, 0x5B, 0x83, 0x77, 0x83, 0x41, 0x30, 0x08, 0x14, 0x00, 0x02, 0x81, 0x44,
+    0x0E, 0x00, 0x37, 0x82, 0x08, 0x09, 0x81, 0x54, 0x08, 0x00, 0x81, 0x68, 0x76, 0x80, 0x80, 0x43,
+    0x00, 0x58, 0x5C, 0x30, 0x08, 0x81, 0x2F, 0x83, 0x52, 0x0A, 0x14, 0x00, 0x80, 0xAC, 0x80, 0xAA,
+    0x30, 0x08, 0x81, 0x2F, 0x83, 0x53, 0x09, 0x14, 0x00, 0x80, 0xAC, 0x80, 0xAA, 0x30, 0x08, 0x81,
+    0x2F, 0x08, 0x81, 0xC3, 0x82, 0x8A, 0x0A, 0x14, 0x65, 0x80, 0xAC, 0x80, 0xAA, 0x30, 0x08, 0x81,
+    0x2F, 0x08, 0x00, 0x83, 0xDA, 0x80, 0xFB, 0x05, 0x03, 0x80, 0xA9, 0x68, 0x82, 0x67, 0x82, 0x14,
+    0x06, 0x81, 0x2A, 0x1D, 0x83, 0x29, 0x82, 0xDC, 0x5F, 0x00, 0x83, 0xDB, 0x0A, 0x6D, 0x82, 0xD1,
+    0x06, 0x81, 0x4A, 0x00, 0x61, 0x80, 0xEE, 0x08, 0x00, 0x80, 0xAE, 0x0B, 0x6D, 0x80, 0xA0, 0x30,
+    0x08, 0x83, 0x02, 0x00, 0x16, 0x0A, 0x14, 0x00, 0x83, 0x03, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58,
+    0x5C, 0x30, 0x08, 0x81, 0xF3, 0x4D, 0x60, 0x0A, 0x14, 0x65, 0x80, 0xAC, 0x80, 0xAA, 0x30, 0x08,
+    0x69, 0x10, 0x17, 0x44, 0x00, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x80,
+    0x92, 0x80, 0x87, 0x00, 0x32, 0x08, 0x80, 0x8C, 0x30, 0x08, 0x69, 0x10, 0x18, 0x44, 0x00, 0x32,
+    0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x80, 0x92, 0x80, 0x87, 0x00, 0x32, 0x08,
+    0x80, 0x8C, 0x30, 0x08, 0x69, 0x10, 0x19, 0x44, 0x00, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02,
+    0x05, 0x03, 0x1D, 0x80, 0x92, 0x80, 0x87, 0x00, 0x32, 0x08, 0x80, 0x8C, 0x30, 0x08, 0x69, 0x10,
+    0x1A, 0x44, 0x00, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x80, 0x92, 0x80,
+    0x87, 0x00, 0x32, 0x08, 0x80, 0x8C, 0x30, 0x08, 0x69, 0x11, 0x17, 0x44, 0x00, 0x32, 0x05, 0x03,
+    0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x80, 0x92, 0x80, 0x87, 0x00, 0x32, 0x08, 0x80, 0x8C,
+    0x30, 0x08, 0x69, 0x11, 0x18, 0x44, 0x00, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03,
+    0x1D, 0x80, 0x92, 0x80, 0x87, 0x00, 0x32, 0x08, 0x80, 0x8C, 0x30, 0x08, 0x69, 0x11, 0x19, 0x44,
+    0x00, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x80, 0x92, 0x80, 0x87, 0x00,
+    0x32, 0x08, 0x80, 0x8C, 0x30, 0x08, 0x69, 0x11, 0x1A, 0x44, 0x00, 0x32, 0x05, 0x03, 0x5D, 0x06,
+    0x00, 0x02, 0x05, 0x03, 0x1D, 0x80, 0x92, 0x80, 0x87, 0x00, 0x32, 0x08, 0x80, 0x8C, 0x30, 0x08,
+    0x69, 0x12, 0x17, 0x44, 0x00, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x80,
+    0x92, 0x80, 0x87, 0x00, 0x32, 0x08, 0x80, 0x8C, 0x30, 0x08, 0x69, 0x12, 0x18, 0x44, 0x00, 0x32,
+    0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x80, 0x92, 0x80, 0x87, 0x00, 0x32, 0x08,
+    0x80, 0x8C, 0x30, 0x08, 0x69, 0x12, 0x19, 0x44, 0x00, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02,
+    0x05, 0x03, 0x1D, 0x80, 0x92, 0x80, 0x87, 0x00, 0x32, 0x08, 0x80, 0x8C, 0x30, 0x08, 0x69, 0x12,
+    0x1A, 0x44, 0x00, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x80, 0x92, 0x80,
+    0x87, 0x00, 0x32, 0x08, 0x80, 0x8C, 0x30, 0x08, 0x69, 0x13, 0x17, 0x44, 0x00, 0x32, 0x05, 0x03,
+    0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x80, 0x92, 0x80, 0x87, 0x00, 0x32, 0x08, 0x80, 0x8C,
+    0x30, 0x08, 0x69, 0x13, 0x18, 0x44, 0x00, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03,
+    0x1D, 0x80, 0x92, 0x80, 0x87, 0x00, 0x32, 0x08, 0x80, 0x8C, 0x30, 0x08, 0x69, 0x13, 0x19, 0x44,
+    0x00, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x80, 0x92, 0x80, 0x87, 0x00,
+    0x32, 0x08, 0x80, 0x8C, 0x30, 0x08, 0x69, 0x13, 0x1A, 0x44, 0x00, 0x32, 0x05, 0x03, 0x5D, 0x06,
+    0x00, 0x02, 0x05, 0x03, 0x1D, 0x80, 0x92, 0x80, 0x87, 0x00, 0x32, 0x08, 0x80, 0x8C, 0x30, 0x08,
+    0x69, 0x00, 0x02, 0x0B, 0x00, 0x32, 0x05, 0x03, 0x80, 0xED, 0x30, 0x08, 0x69, 0x00, 0x16, 0x0A,
+    0x14, 0x27, 0x00, 0x32, 0x80, 0xED, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58, 0x5C, 0x30, 0x08, 0x69,
+    0x00, 0x16, 0x01, 0x32, 0x05, 0x03, 0x5D, 0x06, 0x00, 0x02, 0x05, 0x03, 0x83, 0xFA, 0x09, 0x81,
+    0x54, 0x08, 0x81, 0x68, 0x76, 0x80, 0x80, 0x43, 0x58, 0x5C, 0x30, 0x08, 0x69, 0x00, 0x16, 0x80,
+    0xA7, 0x81, 0x49, 0x03, 0x80, 0xA9, 0x68, 0x5D, 0x32, 0x06, 0x2A, 0x16, 0x81, 0x23, 0x08, 0x00,
+    0x81, 0x1E, 0x5B, 0x81, 0xAB, 0x30, 0x08, 0x80, 0xCE, 0x00, 0x02, 0x80, 0xCF, 0x00, 0x63, 0x0A,
+    0x14, 0x56, 0x00, 0x02, 0x04, 0x1C, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58, 0x5C, 0x30, 0x08, 0x80,
+    0xCE, 0x00, 0x02, 0x80, 0xCF, 0x00, 0x63, 0x0A, 0x14, 0x56, 0x00, 0x02, 0x06, 0x00, 0x39, 0x04,
+    0x1C, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58, 0x5C, 0x30, 0x08, 0x80, 0xCE, 0x00, 0x02, 0x81, 0x50,
+    0x00, 0x6F, 0x0A, 0x81, 0xE5, 0x00, 0x80, 0xB9, 0x1B, 0x00, 0x02, 0x83, 0x32, 0x0B, 0x14, 0x08,
+    0x62, 0x27, 0x00, 0x39, 0x04, 0x1C, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58, 0x5C, 0x30, 0x08, 0x80,
+    0xCE, 0x00, 0x16, 0x0A, 0x53, 0x00, 0x02, 0x0B, 0x81, 0x17, 0x43, 0x00, 0x58, 0x5C, 0x30, 0x08,
+    0x80, 0xCE, 0x00, 0x16, 0x0A, 0x53, 0x00, 0x81, 0x87, 0x81, 0x17, 0x43, 0x00, 0x58, 0x5C, 0x30,
+    0x08, 0x81, 0x3C, 0x4F, 0x81, 0x97, 0x83, 0xFE, 0x0A, 0x43, 0x00, 0x58, 0x80, 0xD8, 0x08, 0x81,
+    0x7B, 0x30, 0x08, 0x81, 0x3C, 0x4F, 0x81, 0x97, 0x82, 0x57, 0x09, 0x43, 0x58, 0x08, 0x81, 0x7B,
+    0x30, 0x08, 0x81, 0x3C, 0x4F, 0x81, 0x97, 0x82, 0x57, 0x09, 0x43, 0x00, 0x58, 0x80, 0xD8, 0x08,
+    0x81, 0x7B, 0x30, 0x08, 0x81, 0x3C, 0x83, 0x4A, 0x5F, 0x51, 0x82, 0xE7, 0x81, 0x6B, 0x0B, 0x81,
+    0x19, 0x82, 0xEE, 0x83, 0xA2, 0x81, 0xEF, 0x04, 0x2F, 0x81, 0x75, 0x5B, 0x83, 0x81, 0x30, 0x08,
+    0x83, 0x84, 0x81, 0xC6, 0x82, 0xCA, 0x80, 0xFB, 0x05, 0x03, 0x80, 0xA9, 0x68, 0x82, 0x67, 0x82,
+    0x14, 0x83, 0xD6, 0x0E, 0x81, 0x06, 0x82, 0x5E, 0x80, 0xAB, 0x06, 0x82, 0x8D, 0x82, 0xC9, 0x83,
+    0xA8, 0x1B, 0x00, 0x80, 0xAE, 0x81, 0x2A, 0x83, 0x36, 0x0A, 0x81, 0x4A, 0x00, 0x61, 0x80, 0xEE,
+    0x08, 0x00, 0x80, 0xAE, 0x0B, 0x6D, 0x80, 0xA0, 0x7B, 0x00, 0x81, 0x91, 0x81, 0x0D, 0x09, 0x14,
+    0x80, 0xAE, 0x80, 0xF8, 0x08, 0x62, 0x56, 0x00, 0x81, 0xC6, 0x82, 0xCB, 0x26, 0x80, 0x94, 0x83,
+    0x1F, 0x30, 0x08, 0x80, 0x99, 0x80, 0xEA, 0x00, 0x02, 0x5F, 0x00, 0x81, 0x18, 0x08, 0x6F, 0x0A,
+    0x14, 0x56, 0x00, 0x02, 0x06, 0x00, 0x39, 0x04, 0x1C, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58, 0x5C,
+    0x30, 0x08, 0x80, 0x99, 0x80, 0xEA, 0x00, 0x02, 0x5F, 0x00, 0x81, 0x18, 0x08, 0x6F, 0x0A, 0x14,
+    0x56, 0x00, 0x02, 0x06, 0x00, 0x39, 0x04, 0x1C, 0x76, 0x80, 0x80, 0x43, 0x00, 0x82, 0x6E, 0x5C,
+    0x30, 0x08, 0x80, 0x99, 0x80, 0xEA, 0x00, 0x02, 0x5F, 0x00, 0x63, 0x0A, 0x14, 0x27, 0x00, 0x02,
+    0x04, 0x2A, 0x06, 0x04, 0x1E, 0x80, 0xF5, 0x00, 0x80, 0xA3, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58,
+    0x5C, 0x30, 0x08, 0x80, 0x99, 0x80, 0xEA, 0x00, 0x02, 0x5F, 0x00, 0x63, 0x0A, 0x14, 0x27, 0x00,
+    0x02, 0x04, 0x2A, 0x06, 0x00, 0x02, 0x04, 0x1E, 0x80, 0xF5, 0x00, 0x80, 0xA3, 0x76, 0x80, 0x80,
+    0x43, 0x00, 0x58, 0x5C, 0x30, 0x08, 0x80, 0x99, 0x80, 0xEA, 0x00, 0x02, 0x5F, 0x00, 0x63, 0x0A,
+    0x14, 0x56, 0x00, 0x02, 0x04, 0x1C, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58, 0x5C, 0x30, 0x08, 0x80,
+    0x99, 0x55, 0x00, 0x02, 0x5F, 0x00, 0x80, 0xA3, 0x0A, 0x14, 0x56, 0x00, 0x32, 0x04, 0x5D, 0x06,
+    0x56, 0x00, 0x02, 0x04, 0x1E, 0x80, 0xF5, 0x00, 0x80, 0xA3, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58,
+    0x5C, 0x30, 0x08, 0x80, 0x99, 0x55, 0x00, 0x02, 0x5F, 0x00, 0x80, 0xA3, 0x80, 0xD5, 0x05, 0x03,
+    0x2C, 0x32, 0x82, 0xF5, 0x06, 0x1E, 0x02, 0x80, 0xF5, 0x00, 0x80, 0xA3, 0x30, 0x08, 0x80, 0x99,
+    0x55, 0x00, 0x02, 0x5F, 0x00, 0x80, 0xA3, 0x80, 0xA7, 0x81, 0x49, 0x03, 0x80, 0xA9, 0x68, 0x5D,
+    0x32, 0x06, 0x02, 0x1E, 0x80, 0xF5, 0x00, 0x80, 0xA3, 0x30, 0x08, 0x80, 0x99, 0x55, 0x00, 0x02,
+    0x5F, 0x00, 0x63, 0x0A, 0x14, 0x27, 0x00, 0x02, 0x04, 0x81, 0x15, 0x06, 0x00, 0x02, 0x04, 0x1E,
+    0x80, 0xF5, 0x00, 0x32, 0x06, 0x5A, 0x80, 0x81, 0x30, 0x08, 0x83, 0xCE, 0x4D, 0x83, 0xF5, 0x0A,
+    0x14, 0x65, 0x80, 0xAC, 0x80, 0xAA, 0x30, 0x08, 0x80, 0xBB, 0x83, 0xAD, 0x81, 0x0F, 0x4E, 0x80,
+    0xB2, 0x00, 0x39, 0x81, 0x0A, 0x07, 0x0F, 0x74, 0x09, 0x2B, 0x0D, 0x1F, 0x16, 0x4E, 0x83, 0x23,
+    0x83, 0x71, 0x80, 0xBA, 0x50, 0x80, 0xD0, 0x83, 0xC4, 0x04, 0x1D, 0x84, 0x23, 0x20, 0x80, 0xA5,
+    0x82, 0x24, 0x80, 0xE4, 0x80, 0xB5, 0x80, 0xDC, 0x05, 0x03, 0x81, 0x8F, 0x4E, 0x04, 0x80, 0xD2,
+    0x82, 0x21, 0x5F, 0x00, 0x4F, 0x81, 0x71, 0x73, 0x07, 0x80, 0x94, 0x81, 0x34, 0x0A, 0x81, 0xB8,
+    0x00, 0x81, 0x87, 0x53, 0x5F, 0x00, 0x39, 0x82, 0x0B, 0x0B, 0x6C, 0x81, 0x10, 0x4E, 0x04, 0x80,
+    0xD2, 0x82, 0x21, 0x5F, 0x00, 0x4F, 0x81, 0x1B, 0x73, 0x07, 0x80, 0x94, 0x81, 0x34, 0x0A, 0x81,
+    0xB8, 0x4F, 0x81, 0x87, 0x53, 0x5F, 0x39, 0x82, 0x0B, 0x0B, 0x6C, 0x4D, 0x60, 0x4E, 0x05, 0x03,
+    0x1E, 0x0E, 0x00, 0x37, 0x41, 0x4E, 0x20, 0x00, 0x39, 0x81, 0x0A, 0x04, 0x40, 0x09, 0x2B, 0x0D,
+    0x1F, 0x16, 0x4E, 0x06, 0x39, 0x05, 0x03, 0x1C, 0x4E, 0x81, 0xA2, 0x28, 0x0A, 0x53, 0x1F, 0x16,
+    0x80, 0xE4, 0x80, 0xB5, 0x80, 0xB3, 0x81, 0x1A, 0x80, 0x8A, 0x68, 0x00, 0x7C, 0x81, 0xC9, 0x0A,
+    0x14, 0x00, 0x81, 0x53, 0x1B, 0x00, 0x81, 0xA0, 0x81, 0x99, 0x80, 0xCA, 0x81, 0xEA, 0x65, 0x81,
+    0x0F, 0x80, 0xE4, 0x80, 0xB5, 0x80, 0xB3, 0x81, 0x1A, 0x80, 0xB8, 0x7B, 0x00, 0x80, 0xB3, 0x80,
+    0x86, 0x81, 0x6D, 0x43, 0x80, 0xC6, 0x80, 0xD8, 0x08, 0x80, 0xBB, 0x00, 0x4D, 0x60, 0x80, 0xE4,
+    0x80, 0xB5, 0x80, 0xDC, 0x04, 0x2F, 0x81, 0x5A, 0x5B, 0x00, 0x2D, 0x4D, 0x60, 0x80, 0xE4, 0x80,
+    0xB5, 0x80, 0xDC, 0x84, 0x03, 0x80, 0xCC, 0x08, 0x82, 0xC1, 0x80, 0xB0, 0x83, 0x06, 0x80, 0xE4,
+    0x80, 0xB5, 0x80, 0xDC, 0x81, 0xB4, 0x55, 0x82, 0xC3, 0x0B, 0x00, 0x2D, 0x83, 0xD7, 0x05, 0x03,
+    0x81, 0x8F, 0x81, 0x67, 0x15, 0x80, 0x83, 0x80, 0x8A, 0x81, 0x5E, 0x81, 0x30, 0x81, 0x3B, 0x01,
+    0x4B, 0x05, 0x03, 0x81, 0x15, 0x06, 0x00, 0x81, 0x29, 0x80, 0xC1, 0x80, 0xB9, 0x05, 0x03, 0x80,
+    0x95, 0x81, 0x67, 0x15, 0x80, 0x93, 0x80, 0x8A, 0x81, 0x5E, 0x81, 0x30, 0x81, 0x3B, 0x01, 0x4B,
+    0x05, 0x03, 0x81, 0x15, 0x06, 0x00, 0x81, 0x29, 0x80, 0xC1, 0x80, 0xB9, 0x05, 0x03, 0x80, 0x95,
+    0x81, 0x67, 0x15, 0x80, 0xC8, 0x80, 0x8A, 0x81, 0x5E, 0x81, 0x30, 0x81, 0x3B, 0x01, 0x4B, 0x05,
+    0x03, 0x81, 0x15, 0x06, 0x00, 0x81, 0x29, 0x80, 0xC1, 0x80, 0xB9, 0x05, 0x03, 0x80, 0x95, 0x81,
+    0xC5, 0x81, 0x4D, 0x80, 0x8A, 0x20, 0x81, 0x62, 0x82, 0x0C, 0x0A, 0x14, 0x0B, 0x80, 0x9D, 0x00,
+    0x83, 0x44, 0x81, 0x17, 0x81, 0x16, 0x80, 0xC6, 0x80, 0xD8, 0x08, 0x80, 0xBB, 0x00, 0x4D, 0x60,
+    0x81, 0xC5, 0x81, 0x4D, 0x80, 0x8A, 0x20, 0x83, 0x45, 0x09, 0x14, 0x0B, 0x80, 0x9D, 0x00, 0x82,
+    0x0C, 0x82, 0x97, 0x83, 0x4B, 0x09, 0x14, 0x00, 0x83, 0x5B, 0x80, 0xE5, 0x66, 0x15, 0x80, 0x83,
+    0x04, 0x1D, 0x81, 0xA6, 0x80, 0x9A, 0x05, 0x03, 0x2A, 0x80, 0xA1, 0x00, 0x81, 0xB1, 0x81, 0x73,
+    0x0B, 0x4B, 0x81, 0xB2, 0x06, 0x00, 0x81, 0x70, 0x81, 0xA5, 0x05, 0x03, 0x1D, 0x81, 0xB3, 0x80,
+    0xE5, 0x66, 0x15, 0x80, 0x93, 0x04, 0x1D, 0x81, 0xA6, 0x80, 0x9A, 0x05, 0x03, 0x2A, 0x80, 0xA1,
+    0x00, 0x81, 0xB1, 0x81, 0x73, 0x0B, 0x4B, 0x81, 0xB2, 0x06, 0x00, 0x81, 0x70, 0x81, 0xA5, 0x05,
+    0x03, 0x1D, 0x81, 0xB3, 0x80, 0xE5, 0x66, 0x15, 0x80, 0xC8, 0x04, 0x1D, 0x81, 0xA6, 0x80, 0x9A,
+    0x05, 0x03, 0x2A, 0x80, 0xA1, 0x00, 0x81, 0xB1, 0x81, 0x73, 0x0B, 0x4B, 0x81, 0xB2, 0x06, 0x00,
+    0x81, 0x70, 0x81, 0xA5, 0x05, 0x03, 0x1D, 0x81, 0xB3, 0x80, 0xE5, 0x80, 0xC3, 0x81, 0x00, 0x80,
+    0xE1, 0x05, 0x03, 0x0D, 0x82, 0xE4, 0x20, 0x00, 0x4B, 0x06, 0x00, 0x4C, 0x84, 0x08, 0x05, 0x2F,
+    0x03, 0x82, 0xF1, 0x80, 0xE5, 0x80, 0xC3, 0x4A, 0x01, 0x83, 0x1D, 0x84, 0x20, 0x04, 0x1D, 0x83,
+    0x3D, 0x80, 0xE5, 0x24, 0x81, 0x95, 0x82, 0x98, 0x81, 0x01, 0x24, 0x05, 0x82, 0x1B, 0x08, 0x02,
+    0x82, 0xF6, 0x0E, 0x00, 0x81, 0x4C, 0x80, 0x9B, 0x05, 0x80, 0x97, 0x00, 0x51, 0x83, 0x15, 0x82,
+    0x99, 0x81, 0xD2, 0x80, 0x9C, 0x4A, 0x82, 0x9B, 0x00, 0x80, 0xF2, 0x83, 0x5E, 0x09, 0x7A, 0x0D,
+    0x83, 0x76, 0x81, 0xC8, 0x80, 0xDA, 0x81, 0x83, 0x81, 0xC8, 0x82, 0x4A, 0x04, 0x2E, 0x0A, 0x6C,
+    0x00, 0x80, 0xC0, 0x82, 0x9F, 0x82, 0x4A, 0x81, 0x92, 0x81, 0x84, 0x09, 0x14, 0x65, 0x80, 0xAC,
+    0x80, 0xAA, 0x82, 0xA2, 0x81, 0x13, 0x81, 0x09, 0x83, 0x48, 0x4A, 0x7C, 0x80, 0xB0, 0x80, 0xB7,
+    0x82, 0xA5, 0x83, 0x92, 0x04, 0x3E, 0x0A, 0x80, 0xF0, 0x82, 0xD0, 0x7C, 0x80, 0xB0, 0x80, 0xB7,
+    0x83, 0x24, 0x81, 0x9C, 0x80, 0x86, 0x3E, 0x0A, 0x81, 0xF8, 0x83, 0x33, 0x81, 0x02, 0x0E, 0x65,
+    0x83, 0x7E, 0x81, 0x0F, 0x7C, 0x80, 0xB0, 0x80, 0xD0, 0x81, 0x9C, 0x80, 0x86, 0x83, 0x18, 0x0A,
+    0x83, 0xBB, 0x65, 0x80, 0xF7, 0x7C, 0x80, 0xC9, 0x80, 0xD3, 0x82, 0xEA, 0x04, 0x83, 0x51, 0x08,
+    0x82, 0xE6, 0x4D, 0x83, 0x2D, 0x80, 0xA6, 0x80, 0xD3, 0x5E, 0x09, 0x83, 0xC8, 0x80, 0xF3, 0x06,
+    0x80, 0xD1, 0x81, 0x41, 0x80, 0xA6, 0x80, 0xD3, 0x83, 0x9C, 0x83, 0x08, 0x07, 0x80, 0x94, 0x80,
+    0xB8, 0x80, 0x9A, 0x05, 0x82, 0xCE, 0x4D, 0x83, 0x59, 0x83, 0x63, 0x0B, 0x82, 0x62, 0x83, 0xC3,
+    0x0A, 0x6D, 0x08, 0x80, 0xF3, 0x06, 0x81, 0xE3, 0x00, 0x80, 0xA6, 0x81, 0x79, 0x80, 0xA6, 0x80,
+    0xD3, 0x83, 0xBD, 0x81, 0x83, 0x09, 0x83, 0xC7, 0x06, 0x80, 0xD1, 0x80, 0xA6, 0x80, 0xD3, 0x81,
+    0xBF, 0x81, 0x1F, 0x07, 0x0D, 0x81, 0x58, 0x80, 0x9A, 0x05, 0x26, 0x4A, 0x81, 0x1F, 0x07, 0x2C,
+    0x81, 0x4F, 0x80, 0xD5, 0x05, 0x03, 0x0D, 0x83, 0x65, 0x82, 0xFA, 0x06, 0x00, 0x0C, 0x05, 0x26,
+    0x4A, 0x81, 0x20, 0x07, 0x0D, 0x81, 0x58, 0x80, 0x9A, 0x05, 0x26, 0x4A, 0x81, 0x20, 0x07, 0x2C,
+    0x81, 0x4F, 0x01, 0x80, 0x9E, 0x05, 0x03, 0x81, 0x45, 0x06, 0x00, 0x0C, 0x05, 0x26, 0x4A, 0x81,
+    0x21, 0x07, 0x0D, 0x81, 0x58, 0x80, 0x9A, 0x05, 0x26, 0x4A, 0x81, 0x21, 0x07, 0x2C, 0x81, 0x4F,
+    0x01, 0x80, 0x9E, 0x05, 0x03, 0x81, 0x45, 0x06, 0x00, 0x0C, 0x05, 0x26, 0x4A, 0x81, 0x22, 0x07,
+    0x0D, 0x81, 0x58, 0x80, 0x9A, 0x05, 0x26, 0x4A, 0x81, 0x22, 0x07, 0x2C, 0x81, 0x4F, 0x01, 0x80,
+    0x9E, 0x05, 0x03, 0x81, 0x45, 0x06, 0x00, 0x0C, 0x05, 0x26, 0x4A, 0x82, 0xA3, 0x80, 0xA8, 0x80,
+    0x98, 0x04, 0x83, 0xA5, 0x82, 0xA4, 0x81, 0x08, 0x81, 0xAD, 0x0E, 0x80, 0xA6, 0x82, 0x86, 0x09,
+    0x82, 0xF3, 0x83, 0xF1, 0x81, 0xAE, 0x81, 0x69, 0x82, 0x0A, 0x80, 0xC5, 0x1D, 0x81, 0x8C, 0x0A,
+    0x14, 0x27, 0x80, 0xE1, 0x04, 0x02, 0x83, 0xD1, 0x82, 0xD8, 0x08, 0x00, 0x81, 0x4C, 0x81, 0x69,
+    0x82, 0x0A, 0x80, 0xC5, 0x1D, 0x80, 0xDD, 0x0A, 0x14, 0x27, 0x00, 0x4C, 0x04, 0x81, 0x1C, 0x06,
+    0x84, 0x04, 0x82, 0xA8, 0x80, 0xB0, 0x27, 0x00, 0x4C, 0x07, 0x80, 0x94, 0x83, 0xCD, 0x81, 0x69,
+    0x24, 0x81, 0x95, 0x82, 0xA7, 0x83, 0xEC, 0x80, 0xCA, 0x80, 0xF2, 0x80, 0xB5, 0x83, 0x4F, 0x00,
+    0x80, 0xDC, 0x81, 0xBB, 0x2F, 0x03, 0x81, 0x5A, 0x5B, 0x00, 0x2D, 0x81, 0x0F, 0x0A, 0x14, 0x27,
+    0x00, 0x02, 0x06, 0x00, 0x39, 0x04, 0x1C, 0x0A, 0x14, 0x27, 0x00, 0x39, 0x06, 0x02, 0x04, 0x1C,
+    0x76, 0x80, 0x80, 0x43, 0x00, 0x58, 0x5C, 0x0A, 0x80, 0xCE, 0x02, 0x80, 0xCF, 0x00, 0x5A, 0x81,
+    0x5D, 0x84, 0x16, 0x73, 0x80, 0x96, 0x2F, 0x03, 0x83, 0xB9, 0x80, 0xE9, 0x83, 0x2A, 0x0A, 0x2B,
+    0x0D, 0x80, 0xA6, 0x80, 0xD9, 0x0B, 0x6C, 0x00, 0x80, 0xAD, 0x60, 0x0A, 0x83, 0x83, 0x00, 0x81,
+    0x4C, 0x7B, 0x00, 0x02, 0x07, 0x80, 0x94, 0x81, 0xFA, 0x43, 0x82, 0x6A, 0x27, 0x73, 0x04, 0x82,
+    0x2A, 0x09, 0x82, 0x37, 0x00, 0x02, 0x81, 0x89, 0x82, 0x4F, 0x0B, 0x81, 0x17, 0x43, 0x82, 0x6C,
+    0x0A, 0x80, 0x99, 0x55, 0x00, 0x02, 0x20, 0x00, 0x39, 0x81, 0x0A, 0x5F, 0x00, 0x80, 0xA3, 0x0A,
+    0x80, 0x99, 0x55, 0x00, 0x02, 0x20, 0x00, 0x39, 0x81, 0x3E, 0x7B, 0x80, 0xA5, 0x80, 0xDE, 0x81,
+    0x0D, 0x09, 0x14, 0x08, 0x62, 0x27, 0x80, 0xE1, 0x04, 0x02, 0x1E, 0x0E, 0x00, 0x32, 0x06, 0x5A,
+    0x82, 0xBB, 0x81, 0xBE, 0x5A, 0x81, 0x5D, 0x27, 0x80, 0x9F, 0x80, 0x86, 0x81, 0xD4, 0x08, 0x81,
+    0x61, 0x81, 0xC1, 0x0A, 0x80, 0x99, 0x55, 0x00, 0x02, 0x20, 0x00, 0x39, 0x81, 0x3E, 0x7B, 0x80,
+    0xA5, 0x80, 0xDE, 0x81, 0x0D, 0x09, 0x14, 0x08, 0x62, 0x27, 0x80, 0xE1, 0x04, 0x02, 0x1E, 0x0E,
+    0x00, 0x80, 0xA3, 0x81, 0xBE, 0x5A, 0x81, 0x5D, 0x27, 0x80, 0x9F, 0x80, 0x86, 0x81, 0xD4, 0x08,
+    0x81, 0x61, 0x81, 0xC1, 0x0A, 0x80, 0x99, 0x00, 0x81, 0x38, 0x02, 0x5F, 0x00, 0x80, 0xA3, 0x0A,
+    0x0F, 0x0D, 0x83, 0xE2, 0x0B, 0x6C, 0x00, 0x80, 0xAD, 0x60, 0x80, 0xE6, 0x80, 0xB3, 0x81, 0x1A,
+    0x80, 0x8A, 0x0E, 0x00, 0x80, 0xF2, 0x83, 0x5D, 0x80, 0xE6, 0x80, 0xF2, 0x80, 0xB5, 0x80, 0xB3,
+    0x26, 0x80, 0x94, 0x80, 0xB8, 0x0A, 0x14, 0x00, 0x80, 0xF2, 0x80, 0xB5, 0x81, 0x53, 0x0B, 0x81,
+    0x7E, 0x27, 0x00, 0x81, 0x42, 0x81, 0x14, 0x03, 0x80, 0xF9, 0x80, 0xE6, 0x82, 0x52, 0x80, 0xB3,
+    0x81, 0x1A, 0x80, 0xB8, 0x0A, 0x14, 0x00, 0x4D, 0x81, 0x53, 0x0B, 0x81, 0x7E, 0x27, 0x00, 0x81,
+    0x42, 0x81, 0x14, 0x03, 0x80, 0xF9, 0x80, 0xE6, 0x82, 0x52, 0x80, 0xAB, 0x6E, 0x80, 0xB8, 0x80,
+    0xE7, 0x81, 0x43, 0x80, 0x86, 0x2F, 0x81, 0x72, 0x08, 0x03, 0x81, 0xA7, 0x64, 0x66, 0x81, 0x60,
+    0x06, 0x81, 0x1B, 0x81, 0xA3, 0x81, 0x60, 0x04, 0x83, 0xD0, 0x80, 0xE7, 0x81, 0x43, 0x80, 0x86,
+    0x2F, 0x81, 0x72, 0x08, 0x03, 0x81, 0xA7, 0x64, 0x81, 0x60, 0x83, 0x30, 0x80, 0xE7, 0x81, 0x43,
+    0x80, 0x86, 0x2F, 0x81, 0x72, 0x08, 0x03, 0x81, 0xA7, 0x64, 0x81, 0x60, 0x83, 0x64, 0x80, 0xB1,
+    0x82, 0x81, 0x83, 0x6F, 0x54, 0x83, 0xF3, 0x83, 0xF7, 0x05, 0x81, 0x2D, 0x4C, 0x83, 0x05, 0x80,
+    0xB1, 0x81, 0xCD, 0x50, 0x82, 0x7E, 0x82, 0x7F, 0x82, 0x9E, 0x4A, 0x80, 0xB1, 0x81, 0xCD, 0x50,
+    0x4C, 0x24, 0x83, 0xB5, 0x80, 0xB1, 0x82, 0x55, 0x50, 0x80, 0xC3, 0x80, 0xD6, 0x80, 0x9C, 0x4A,
+    0x80, 0xB1, 0x82, 0x55, 0x50, 0x00, 0x61, 0x6E, 0x84, 0x0F, 0x08, 0x83, 0x93, 0x00, 0x81, 0x88,
+    0x0A, 0x81, 0x11, 0x65, 0x4D, 0x60, 0x80, 0xB1, 0x6E, 0x82, 0xE8, 0x80, 0xB1, 0x6E, 0x81, 0x9D,
+    0x68, 0x00, 0x82, 0x61, 0x80, 0x9B, 0x80, 0x96, 0x82, 0x47, 0x80, 0xC6, 0x08, 0x81, 0xE9, 0x81,
+    0x10, 0x80, 0xB1, 0x6E, 0x81, 0x9D, 0x68, 0x00, 0x82, 0x61, 0x80, 0x9B, 0x80, 0x96, 0x81, 0x16,
+    0x80, 0xC6, 0x08, 0x80, 0xBB, 0x00, 0x4D, 0x60, 0x80, 0xB1, 0x6E, 0x81, 0x9D, 0x5B, 0x84, 0x13,
+    0x83, 0xBE, 0x80, 0x9B, 0x80, 0x96, 0x81, 0x16, 0x80, 0xC6, 0x08, 0x80, 0xBB, 0x00, 0x4D, 0x60,
+    0x81, 0x6A, 0x02, 0x07, 0x81, 0x9E, 0x81, 0x5F, 0x0E, 0x00, 0x81, 0x19, 0x82, 0xEF, 0x80, 0xFB,
+    0x05, 0x81, 0x2D, 0x0D, 0x37, 0x81, 0x8A, 0x82, 0xF7, 0x81, 0x6A, 0x02, 0x05, 0x26, 0x81, 0x9E,
+    0x81, 0x5F, 0x0E, 0x00, 0x81, 0x19, 0x81, 0x2E, 0x81, 0x6A, 0x02, 0x05, 0x26, 0x81, 0x9E, 0x81,
+    0x5F, 0x0E, 0x00, 0x81, 0x19, 0x81, 0x2E, 0x0A, 0x14, 0x0B, 0x80, 0x9D, 0x00, 0x81, 0x2E, 0x80,
+    0xFD, 0x81, 0x03, 0x80, 0xBE, 0x04, 0x0E, 0x82, 0x35, 0x82, 0x51, 0x80, 0xDB, 0x81, 0x35, 0x80,
+    0xBE, 0x25, 0x03, 0x83, 0x9D, 0x80, 0x9B, 0x80, 0x96, 0x83, 0xDD, 0x00, 0x80, 0xFD, 0x81, 0x03,
+    0x20, 0x00, 0x81, 0x57, 0x5B, 0x80, 0xBE, 0x06, 0x83, 0x20, 0x00, 0x80, 0xFD, 0x81, 0x03, 0x83,
+    0x10, 0x82, 0x31, 0x20, 0x81, 0x57, 0x0B, 0x6D, 0x80, 0xDB, 0x81, 0x35, 0x81, 0xDE, 0x33, 0x25,
+    0x03, 0x67, 0x50, 0x1B, 0x0D, 0x59, 0x06, 0x7F, 0x35, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x2C,
+    0x81, 0x37, 0x80, 0xEC, 0x80, 0xAB, 0x0E, 0x82, 0x76, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x2C,
+    0x81, 0x37, 0x80, 0xEC, 0x80, 0xAB, 0x0E, 0x82, 0x77, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x2C,
+    0x81, 0x37, 0x80, 0xEC, 0x80, 0xAB, 0x0E, 0x82, 0x78, 0x33, 0x25, 0x03, 0x67, 0x50, 0x1B, 0x2C,
+    0x81, 0x37, 0x80, 0xEC, 0x80, 0xAB, 0x0E, 0x82, 0x79, 0x82, 0xAB, 0x80, 0xBA, 0x81, 0x71, 0x80,
+    0xE0, 0x83, 0x66, 0x82, 0xAC, 0x80, 0x9E, 0x80, 0xBA, 0x80, 0xCC, 0x08, 0x83, 0x4C, 0x83, 0x97,
+    0x0A, 0x14, 0x00, 0x83, 0x96, 0x0B, 0x6D, 0x80, 0xA0, 0x82, 0xAD, 0x83, 0xF8, 0x83, 0x0B, 0x82,
+    0xDA, 0x82, 0xF9, 0x09, 0x80, 0xBB, 0x4D, 0x0B, 0x14, 0x27, 0x80, 0xE1, 0x80, 0x86, 0x80, 0xE9,
+    0x80, 0xB5, 0x83, 0xEA, 0x83, 0xB6, 0x82, 0xAE, 0x5B, 0x00, 0x4D, 0x81, 0x42, 0x4A, 0x0A, 0x14,
+    0x65, 0x80, 0xF8, 0x0B, 0x6C, 0x00, 0x4D, 0x60, 0x81, 0xCC, 0x81, 0x4D, 0x26, 0x81, 0x86, 0x80,
+    0xF1, 0x06, 0x00, 0x32, 0x04, 0x2F, 0x81, 0x39, 0x81, 0x9A, 0x7B, 0x00, 0x80, 0xB3, 0x80, 0x86,
+    0x81, 0x6D, 0x43, 0x80, 0xC6, 0x80, 0xD8, 0x08, 0x80, 0xBB, 0x00, 0x4D, 0x60, 0x81, 0xCC, 0x81,
+    0x4D, 0x05, 0x26, 0x81, 0x86, 0x80, 0xF1, 0x06, 0x00, 0x32, 0x04, 0x2F, 0x81, 0x39, 0x81, 0x9A,
+    0x0A, 0x14, 0x0B, 0x81, 0x7E, 0x27, 0x00, 0x80, 0xAD, 0x81, 0x14, 0x03, 0x80, 0xF9, 0x81, 0x6B,
+    0x80, 0xB3, 0x81, 0x1A, 0x80, 0x8A, 0x68, 0x00, 0x81, 0xC0, 0x80, 0xE7, 0x81, 0xCB, 0x0A, 0x14,
+    0x00, 0x81, 0x53, 0x1B, 0x00, 0x81, 0xA0, 0x81, 0x99, 0x80, 0xCA, 0x81, 0xEA, 0x65, 0x81, 0x0F,
+    0x81, 0x6B, 0x80, 0xAB, 0x6E, 0x80, 0xB8, 0x82, 0xB0, 0x80, 0xAD, 0x4A, 0x09, 0x80, 0xE0, 0x83,
+    0x04, 0x00, 0x61, 0x0B, 0x81, 0x11, 0x00, 0x4D, 0x60, 0x82, 0xB1, 0x83, 0x37, 0x35, 0x0A, 0x14,
+    0x00, 0x80, 0xAC, 0x0B, 0x6D, 0x80, 0xA0, 0x80, 0x9B, 0x80, 0x96, 0x6C, 0x06, 0x84, 0x17, 0x00,
+    0x61, 0x27, 0x00, 0x81, 0x91, 0x83, 0x9E, 0x82, 0xB4, 0x80, 0xA1, 0x00, 0x7C, 0x80, 0xB0, 0x80,
+    0xB7, 0x0B, 0x82, 0xA0, 0x04, 0x3E, 0x0A, 0x6C, 0x65, 0x80, 0xF7, 0x81, 0xCE, 0x81, 0x83, 0x81,
+    0xCE, 0x83, 0xF4, 0x04, 0x71, 0x09, 0x83, 0xD4, 0x81, 0x3A, 0x82, 0x4B, 0x01, 0x82, 0x75, 0x81,
+    0x0B, 0x04, 0x2E, 0x0A, 0x6C, 0x00, 0x80, 0xC0, 0x01, 0x4F, 0x82, 0x9A, 0x80, 0xDA, 0x04, 0x80,
+    0xD7, 0x00, 0x81, 0x2B, 0x05, 0x03, 0x2F, 0x84, 0x24, 0x81, 0x7A, 0x01, 0x4F, 0x77, 0x0C, 0x04,
+    0x29, 0x80, 0xA7, 0x81, 0x32, 0x03, 0x80, 0xCC, 0x08, 0x81, 0x81, 0x02, 0x06, 0x0D, 0x2A, 0x81,
+    0xAF, 0x01, 0x4F, 0x80, 0xBA, 0x08, 0x81, 0xE3, 0x16, 0x01, 0x4F, 0x80, 0xBA, 0x08, 0x82, 0x48,
+    0x16, 0x80, 0x9B, 0x82, 0xE9, 0x00, 0x80, 0xB9, 0x1B, 0x65, 0x02, 0x82, 0x00, 0x0B, 0x82, 0x3B,
+    0x7B, 0x80, 0xA5, 0x80, 0xDE, 0x81, 0x0D, 0x09, 0x14, 0x00, 0x5A, 0x82, 0x5F, 0x0E, 0x4F, 0x5B,
+    0x80, 0xE9, 0x82, 0x4C, 0x1B, 0x82, 0x65, 0x0B, 0x82, 0x5A, 0x01, 0x4F, 0x80, 0xBA, 0x08, 0x82,
+    0x48, 0x55, 0x16, 0x80, 0x9B, 0x80, 0x96, 0x81, 0xE5, 0x00, 0x80, 0xB9, 0x1B, 0x65, 0x02, 0x82,
+    0x00, 0x0B, 0x82, 0x3B, 0x7B, 0x80, 0xA5, 0x80, 0xDE, 0x81, 0x0D, 0x09, 0x14, 0x00, 0x5A, 0x82,
+    0x5F, 0x0E, 0x4F, 0x5B, 0x80, 0xE9, 0x82, 0x4C, 0x1B, 0x82, 0x65, 0x0B, 0x82, 0x5A, 0x01, 0x4F,
+    0x07, 0x80, 0x94, 0x83, 0x0F, 0x5B, 0x0D, 0x83, 0xAF, 0x82, 0xE5, 0x73, 0x80, 0xD2, 0x07, 0x02,
+    0x83, 0x62, 0x0A, 0x81, 0xB8, 0x00, 0x4F, 0x02, 0x82, 0x6F, 0x0B, 0x82, 0x56, 0x08, 0x00, 0x39,
+    0x81, 0x0A, 0x02, 0x5B, 0x81, 0x10, 0x01, 0x4F, 0x04, 0x81, 0xF1, 0x09, 0x53, 0x02, 0x5F, 0x39,
+    0x81, 0x3E, 0x01, 0x4F, 0x81, 0x0B, 0x04, 0x2E, 0x0A, 0x6C, 0x00, 0x80, 0xC0, 0x01, 0x10, 0x17,
+    0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A,
+    0x01, 0x10, 0x17, 0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x10, 0x17,
+    0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x10, 0x18, 0x0C, 0x07,
+    0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x10,
+    0x18, 0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x10, 0x18, 0x0C, 0x3B,
+    0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x10, 0x19, 0x0C, 0x07, 0x38, 0x01,
+    0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x10, 0x19, 0x0C,
+    0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x10, 0x19, 0x0C, 0x3B, 0x34, 0x04,
+    0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x10, 0x1A, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C,
+    0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x10, 0x1A, 0x0C, 0x04, 0x29,
+    0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x10, 0x1A, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01,
+    0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x10, 0x77, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03,
+    0x81, 0x1C, 0x80, 0xF1, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x10, 0x77, 0x0C, 0x04,
+    0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x10, 0x77, 0x0C, 0x3D, 0x34, 0x04, 0x2E,
+    0x01, 0x3D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x10, 0x77, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D,
+    0x15, 0x05, 0x03, 0x23, 0x01, 0x10, 0x80, 0x8D, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06,
+    0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x10, 0x80, 0x8D, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05,
+    0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x10, 0x80, 0x8D, 0x0C, 0x04, 0x29,
+    0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x10, 0x80, 0x8D, 0x0C, 0x3B, 0x34, 0x04, 0x2E,
+    0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x10, 0x80, 0x8E, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03,
+    0x21, 0x06, 0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x10, 0x80, 0x8E, 0x0C, 0x07, 0x38, 0x01, 0x36,
+    0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x10, 0x80, 0x8E, 0x0C,
+    0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x10, 0x80, 0x8E, 0x0C, 0x3B, 0x34,
+    0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x10, 0x80, 0x8F, 0x04, 0x29, 0x01, 0x02,
+    0x05, 0x03, 0x21, 0x06, 0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x10, 0x80, 0x8F, 0x0C, 0x07, 0x38,
+    0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x10, 0x80,
+    0x8F, 0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x10, 0x80, 0x8F, 0x0C,
+    0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x10, 0x80, 0x90, 0x04, 0x29,
+    0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x10, 0x80, 0x90, 0x0C,
+    0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01,
+    0x10, 0x80, 0x90, 0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x10, 0x80,
+    0x90, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x11, 0x17, 0x0C,
+    0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01,
+    0x11, 0x17, 0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x11, 0x17, 0x0C,
+    0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x11, 0x18, 0x0C, 0x07, 0x38,
+    0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x11, 0x18,
+    0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x11, 0x18, 0x0C, 0x3B, 0x34,
+    0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x11, 0x19, 0x0C, 0x07, 0x38, 0x01, 0x36,
+    0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x11, 0x19, 0x0C, 0x04,
+    0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x11, 0x19, 0x0C, 0x3B, 0x34, 0x04, 0x2E,
+    0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x11, 0x1A, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05,
+    0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x11, 0x1A, 0x0C, 0x04, 0x29, 0x01,
+    0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x11, 0x1A, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D,
+    0x15, 0x05, 0x03, 0x23, 0x01, 0x11, 0x77, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x81,
+    0x1C, 0x80, 0xF1, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x11, 0x77, 0x0C, 0x04, 0x29,
+    0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x11, 0x77, 0x0C, 0x3D, 0x34, 0x04, 0x2E, 0x01,
+    0x3D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x11, 0x77, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15,
+    0x05, 0x03, 0x23, 0x01, 0x11, 0x80, 0x8D, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x00,
+    0x39, 0x05, 0x03, 0x1C, 0x01, 0x11, 0x80, 0x8D, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03,
+    0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x11, 0x80, 0x8D, 0x0C, 0x04, 0x29, 0x01,
+    0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x11, 0x80, 0x8D, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01,
+    0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x11, 0x80, 0x8E, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21,
+    0x06, 0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x11, 0x80, 0x8E, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C,
+    0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x11, 0x80, 0x8E, 0x0C, 0x04,
+    0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x11, 0x80, 0x8E, 0x0C, 0x3B, 0x34, 0x04,
+    0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x11, 0x80, 0x8F, 0x04, 0x29, 0x01, 0x02, 0x05,
+    0x03, 0x21, 0x06, 0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x11, 0x80, 0x8F, 0x0C, 0x07, 0x38, 0x01,
+    0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x11, 0x80, 0x8F,
+    0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x11, 0x80, 0x8F, 0x0C, 0x3B,
+    0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x11, 0x80, 0x90, 0x04, 0x29, 0x01,
+    0x02, 0x05, 0x03, 0x21, 0x06, 0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x11, 0x80, 0x90, 0x0C, 0x07,
+    0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x11,
+    0x80, 0x90, 0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x11, 0x80, 0x90,
+    0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x12, 0x17, 0x0C, 0x07,
+    0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x12,
+    0x17, 0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x12, 0x17, 0x0C, 0x3B,
+    0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x12, 0x18, 0x0C, 0x07, 0x38, 0x01,
+    0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x12, 0x18, 0x0C,
+    0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x12, 0x18, 0x0C, 0x3B, 0x34, 0x04,
+    0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x12, 0x19, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C,
+    0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x12, 0x19, 0x0C, 0x04, 0x29,
+    0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x12, 0x19, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01,
+    0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x12, 0x1A, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03,
+    0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x12, 0x1A, 0x0C, 0x04, 0x29, 0x01, 0x02,
+    0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x12, 0x1A, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15,
+    0x05, 0x03, 0x23, 0x01, 0x12, 0x77, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x81, 0x1C,
+    0x80, 0xF1, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x12, 0x77, 0x0C, 0x04, 0x29, 0x01,
+    0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x12, 0x77, 0x0C, 0x3D, 0x34, 0x04, 0x2E, 0x01, 0x3D,
+    0x15, 0x05, 0x03, 0x23, 0x01, 0x12, 0x77, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05,
+    0x03, 0x23, 0x01, 0x12, 0x80, 0x8D, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x00, 0x39,
+    0x05, 0x03, 0x1C, 0x01, 0x12, 0x80, 0x8D, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x46,
+    0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x12, 0x80, 0x8D, 0x0C, 0x04, 0x29, 0x01, 0x02,
+    0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x12, 0x80, 0x8D, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D,
+    0x15, 0x05, 0x03, 0x23, 0x01, 0x12, 0x80, 0x8E, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06,
+    0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x12, 0x80, 0x8E, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05,
+    0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x12, 0x80, 0x8E, 0x0C, 0x04, 0x29,
+    0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x12, 0x80, 0x8E, 0x0C, 0x3B, 0x34, 0x04, 0x2E,
+    0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x12, 0x80, 0x8F, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03,
+    0x21, 0x06, 0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x12, 0x80, 0x8F, 0x0C, 0x07, 0x38, 0x01, 0x36,
+    0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x12, 0x80, 0x8F, 0x0C,
+    0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x12, 0x80, 0x8F, 0x0C, 0x3B, 0x34,
+    0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x12, 0x80, 0x90, 0x04, 0x29, 0x01, 0x02,
+    0x05, 0x03, 0x21, 0x06, 0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x12, 0x80, 0x90, 0x0C, 0x07, 0x38,
+    0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x12, 0x80,
+    0x90, 0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x12, 0x80, 0x90, 0x0C,
+    0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x13, 0x17, 0x0C, 0x07, 0x38,
+    0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x13, 0x17,
+    0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x13, 0x17, 0x0C, 0x3B, 0x34,
+    0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x13, 0x18, 0x0C, 0x07, 0x38, 0x01, 0x36,
+    0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x13, 0x18, 0x0C, 0x04,
+    0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x13, 0x18, 0x0C, 0x3B, 0x34, 0x04, 0x2E,
+    0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x13, 0x19, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05,
+    0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x13, 0x19, 0x0C, 0x04, 0x29, 0x01,
+    0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x13, 0x19, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D,
+    0x15, 0x05, 0x03, 0x23, 0x01, 0x13, 0x1A, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x46,
+    0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x13, 0x1A, 0x0C, 0x04, 0x29, 0x01, 0x02, 0x05,
+    0x03, 0x21, 0x06, 0x1C, 0x01, 0x13, 0x1A, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05,
+    0x03, 0x23, 0x01, 0x13, 0x77, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x81, 0x1C, 0x80,
+    0xF1, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x13, 0x77, 0x0C, 0x04, 0x29, 0x01, 0x02,
+    0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x13, 0x77, 0x0C, 0x3D, 0x34, 0x04, 0x2E, 0x01, 0x3D, 0x15,
+    0x05, 0x03, 0x23, 0x01, 0x13, 0x77, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03,
+    0x23, 0x01, 0x13, 0x80, 0x8D, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x00, 0x39, 0x05,
+    0x03, 0x1C, 0x01, 0x13, 0x80, 0x8D, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03, 0x46, 0x06,
+    0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x13, 0x80, 0x8D, 0x0C, 0x04, 0x29, 0x01, 0x02, 0x05,
+    0x03, 0x21, 0x06, 0x1C, 0x01, 0x13, 0x80, 0x8D, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15,
+    0x05, 0x03, 0x23, 0x01, 0x13, 0x80, 0x8E, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x00,
+    0x39, 0x05, 0x03, 0x1C, 0x01, 0x13, 0x80, 0x8E, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C, 0x05, 0x03,
+    0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x13, 0x80, 0x8E, 0x0C, 0x04, 0x29, 0x01,
+    0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x13, 0x80, 0x8E, 0x0C, 0x3B, 0x34, 0x04, 0x2E, 0x01,
+    0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x13, 0x80, 0x8F, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21,
+    0x06, 0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x13, 0x80, 0x8F, 0x0C, 0x07, 0x38, 0x01, 0x36, 0x3C,
+    0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x13, 0x80, 0x8F, 0x0C, 0x04,
+    0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x13, 0x80, 0x8F, 0x0C, 0x3B, 0x34, 0x04,
+    0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x13, 0x80, 0x90, 0x04, 0x29, 0x01, 0x02, 0x05,
+    0x03, 0x21, 0x06, 0x00, 0x39, 0x05, 0x03, 0x1C, 0x01, 0x13, 0x80, 0x90, 0x0C, 0x07, 0x38, 0x01,
+    0x36, 0x3C, 0x05, 0x03, 0x46, 0x06, 0x00, 0x02, 0x05, 0x03, 0x1D, 0x3A, 0x01, 0x13, 0x80, 0x90,
+    0x0C, 0x04, 0x29, 0x01, 0x02, 0x05, 0x03, 0x21, 0x06, 0x1C, 0x01, 0x13, 0x80, 0x90, 0x0C, 0x3B,
+    0x34, 0x04, 0x2E, 0x01, 0x2D, 0x15, 0x05, 0x03, 0x23, 0x01, 0x82, 0x82, 0x81, 0x0B, 0x04, 0x2E,
+    0x0A, 0x6C, 0x00, 0x80, 0xC0, 0x01, 0x81, 0xCA, 0x81, 0x0B, 0x04, 0x81, 0x96, 0x09, 0x6C, 0x00,
+    0x80, 0xDB, 0x06, 0x14, 0x80, 0xDB, 0x81, 0x2B, 0x80, 0xAA, 0x01, 0x7C, 0x80, 0xB0, 0x82, 0x9D,
+    0x05, 0x03, 0x80, 0x95, 0x01, 0x7C, 0x80, 0xB0, 0x80, 0xB7, 0x04, 0x83, 0x6C, 0x0B, 0x82, 0x3D,
+    0x83, 0x39, 0x05, 0x83, 0x26, 0x0A, 0x80, 0xF0, 0x82, 0xCF, 0x27, 0x80, 0xA5, 0x80, 0xDE, 0x83,
+    0x5A, 0x82, 0xD7, 0x0E, 0x81, 0x4B, 0x83, 0xB3, 0x01, 0x7C, 0x80, 0xB0, 0x80, 0xB7, 0x04, 0x83,
+    0x89, 0x0A, 0x14, 0x00, 0x59, 0x80, 0xAA, 0x01, 0x7C, 0x80, 0xB0, 0x80, 0xB7, 0x82, 0x1C, 0x80,
+    0xC5, 0x08, 0x03, 0x81, 0x33, 0x0A, 0x80, 0x9D, 0x00, 0x82, 0x1D, 0x01, 0x7C, 0x80, 0xC9, 0x80,
+    0xD9, 0x83, 0xE0, 0x81, 0x06, 0x04, 0x72, 0x0A, 0x81, 0x61, 0x00, 0x80, 0xC9, 0x80, 0xD9, 0x81,
+    0xA3, 0x37, 0x08, 0x81, 0xA3, 0x06, 0x80, 0xF3, 0x81, 0x41, 0x7B, 0x73, 0x80, 0xD2, 0x25, 0x03,
+    0x83, 0x49, 0x09, 0x80, 0xD1, 0x00, 0x7C, 0x80, 0xC9, 0x81, 0x79, 0x01, 0x80, 0xA6, 0x80, 0xD3,
+    0x04, 0x84, 0x2A, 0x0A, 0x80, 0xD1, 0x00, 0x80, 0xA6, 0x82, 0x84, 0x01, 0x33, 0x80, 0xA2, 0x80,
+    0xA1, 0x10, 0x17, 0x80, 0xC7, 0x18, 0x07, 0x2C, 0x35, 0x01, 0x33, 0x80, 0xA2, 0x80, 0xA1, 0x10,
+    0x19, 0x80, 0xC7, 0x1A, 0x07, 0x2C, 0x35, 0x01, 0x33, 0x80, 0xA2, 0x80, 0xA1, 0x11, 0x17, 0x80,
+    0xC7, 0x18, 0x07, 0x2C, 0x35, 0x01, 0x33, 0x80, 0xA2, 0x80, 0xA1, 0x11, 0x19, 0x80, 0xC7, 0x1A,
+    0x07, 0x2C, 0x35, 0x01, 0x33, 0x80, 0xA2, 0x80, 0xA1, 0x12, 0x17, 0x80, 0xC7, 0x18, 0x07, 0x2C,
+    0x35, 0x01, 0x33, 0x80, 0xA2, 0x80, 0xA1, 0x12, 0x19, 0x80, 0xC7, 0x1A, 0x07, 0x2C, 0x35, 0x01,
+    0x33, 0x80, 0xA2, 0x80, 0xA1, 0x13, 0x17, 0x80, 0xC7, 0x18, 0x07, 0x2C, 0x35, 0x01, 0x33, 0x80,
+    0xA2, 0x80, 0xA1, 0x13, 0x19, 0x80, 0xC7, 0x1A, 0x07, 0x2C, 0x35, 0x01, 0x31, 0x20, 0x10, 0x17,
+    0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x10, 0x17, 0x04, 0x80, 0x89, 0x06, 0x00, 0x79, 0x7E, 0x25,
+    0x03, 0x45, 0x01, 0x31, 0x20, 0x10, 0x17, 0x04, 0x72, 0x01, 0x31, 0x20, 0x10, 0x18, 0x25, 0x03,
+    0x45, 0x01, 0x31, 0x20, 0x10, 0x18, 0x04, 0x80, 0x89, 0x06, 0x00, 0x79, 0x7E, 0x25, 0x03, 0x45,
+    0x01, 0x31, 0x20, 0x10, 0x18, 0x04, 0x72, 0x01, 0x31, 0x20, 0x10, 0x19, 0x25, 0x03, 0x45, 0x01,
+    0x31, 0x20, 0x10, 0x19, 0x04, 0x80, 0x89, 0x06, 0x00, 0x79, 0x7E, 0x25, 0x03, 0x45, 0x01, 0x31,
+    0x20, 0x10, 0x19, 0x04, 0x72, 0x01, 0x31, 0x20, 0x10, 0x1A, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20,
+    0x10, 0x1A, 0x04, 0x80, 0x89, 0x06, 0x00, 0x79, 0x7E, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x10,
+    0x1A, 0x04, 0x72, 0x01, 0x31, 0x20, 0x11, 0x17, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x11, 0x17,
+    0x04, 0x80, 0x89, 0x06, 0x00, 0x79, 0x7E, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x11, 0x17, 0x04,
+    0x72, 0x01, 0x31, 0x20, 0x11, 0x18, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x11, 0x18, 0x04, 0x80,
+    0x89, 0x06, 0x00, 0x79, 0x7E, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x11, 0x18, 0x04, 0x72, 0x01,
+    0x31, 0x20, 0x11, 0x19, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x11, 0x19, 0x04, 0x80, 0x89, 0x06,
+    0x00, 0x79, 0x7E, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x11, 0x19, 0x04, 0x72, 0x01, 0x31, 0x20,
+    0x11, 0x1A, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x11, 0x1A, 0x04, 0x80, 0x89, 0x06, 0x00, 0x79,
+    0x7E, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x11, 0x1A, 0x04, 0x72, 0x01, 0x31, 0x20, 0x12, 0x17,
+    0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x12, 0x17, 0x04, 0x80, 0x89, 0x06, 0x00, 0x79, 0x7E, 0x25,
+    0x03, 0x45, 0x01, 0x31, 0x20, 0x12, 0x17, 0x04, 0x72, 0x01, 0x31, 0x20, 0x12, 0x18, 0x25, 0x03,
+    0x45, 0x01, 0x31, 0x20, 0x12, 0x18, 0x04, 0x80, 0x89, 0x06, 0x00, 0x79, 0x7E, 0x25, 0x03, 0x45,
+    0x01, 0x31, 0x20, 0x12, 0x18, 0x04, 0x72, 0x01, 0x31, 0x20, 0x12, 0x19, 0x25, 0x03, 0x45, 0x01,
+    0x31, 0x20, 0x12, 0x19, 0x04, 0x80, 0x89, 0x06, 0x00, 0x79, 0x7E, 0x25, 0x03, 0x45, 0x01, 0x31,
+    0x20, 0x12, 0x19, 0x04, 0x72, 0x01, 0x31, 0x20, 0x12, 0x1A, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20,
+    0x12, 0x1A, 0x04, 0x80, 0x89, 0x06, 0x00, 0x79, 0x7E, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x12,
+    0x1A, 0x04, 0x72, 0x01, 0x31, 0x20, 0x13, 0x17, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x13, 0x17,
+    0x04, 0x80, 0x89, 0x06, 0x00, 0x79, 0x7E, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x13, 0x17, 0x04,
+    0x72, 0x01, 0x31, 0x20, 0x13, 0x18, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x13, 0x18, 0x04, 0x80,
+    0x89, 0x06, 0x00, 0x79, 0x7E, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x13, 0x18, 0x04, 0x72, 0x01,
+    0x31, 0x20, 0x13, 0x19, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x13, 0x19, 0x04, 0x80, 0x89, 0x06,
+    0x00, 0x79, 0x7E, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x13, 0x19, 0x04, 0x72, 0x01, 0x31, 0x20,
+    0x13, 0x1A, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x13, 0x1A, 0x04, 0x80, 0x89, 0x06, 0x00, 0x79,
+    0x7E, 0x25, 0x03, 0x45, 0x01, 0x31, 0x20, 0x13, 0x1A, 0x04, 0x72, 0x01, 0x80, 0xC9, 0x80, 0xD3,
+    0x81, 0xEB, 0x04, 0x2E, 0x01, 0x80, 0xD6, 0x80, 0x9C, 0x0C, 0x83, 0x3C, 0x2A, 0x64, 0x83, 0x78,
+    0x06, 0x00, 0x36, 0x66, 0x15, 0x05, 0x26, 0x2C, 0x83, 0x56, 0x09, 0x14, 0x27, 0x80, 0xE1, 0x04,
+    0x80, 0xE9, 0x82, 0x01, 0x82, 0x25, 0x20, 0x00, 0x80, 0xD6, 0x82, 0x4E, 0x06, 0x80, 0xD6, 0x80,
+    0xFA, 0x80, 0xEB, 0x84, 0x26, 0x01, 0x80, 0xD6, 0x80, 0x9C, 0x0C, 0x80, 0xC5, 0x08, 0x03, 0x2A,
+    0x81, 0x1B, 0x83, 0x79, 0x0A, 0x14, 0x27, 0x80, 0xE1, 0x04, 0x80, 0xE9, 0x82, 0x01, 0x82, 0x25,
+    0x20, 0x00, 0x80, 0xD6, 0x82, 0x4E, 0x06, 0x80, 0xD6, 0x80, 0xFA, 0x80, 0xEB, 0x84, 0x25, 0x81,
+    0xBF, 0x01, 0x81, 0x01, 0x24, 0x81, 0x82, 0x81, 0xFD, 0x82, 0x63, 0x82, 0x5B, 0x80, 0xFB, 0x05,
+    0x81, 0x2D, 0x4C, 0x81, 0xE6, 0x0A, 0x82, 0x18, 0x00, 0x80, 0xC1, 0x81, 0x07, 0x1B, 0x61, 0x81,
+    0x9B, 0x82, 0x7C, 0x84, 0x0E, 0x82, 0x2B, 0x00, 0x81, 0x07, 0x83, 0x8D, 0x81, 0xEF, 0x84, 0x02,
+    0x01, 0x81, 0x01, 0x24, 0x81, 0x82, 0x00, 0x81, 0xFD, 0x82, 0x63, 0x82, 0x5B, 0x80, 0xFB, 0x05,
+    0x81, 0x2D, 0x0D, 0x4C, 0x81, 0xE6, 0x0A, 0x82, 0x18, 0x00, 0x80, 0xC1, 0x81, 0x07, 0x1B, 0x00,
+    0x61, 0x80, 0x97, 0x06, 0x83, 0x69, 0x00, 0x81, 0x01, 0x80, 0xBC, 0x01, 0x80, 0xA8, 0x80, 0x98,
+    0x04, 0x2F, 0x83, 0xA4, 0x81, 0x52, 0x0A, 0x81, 0x6F, 0x81, 0x41, 0x01, 0x80, 0xA8, 0x80, 0x98,
+    0x82, 0x22, 0x81, 0x98, 0x04, 0x2F, 0x80, 0xB8, 0x0A, 0x14, 0x27, 0x00, 0x80, 0xA8, 0x80, 0x98,
+    0x04, 0x82, 0xD3, 0x81, 0xEC, 0x01, 0x80, 0xA8, 0x80, 0x98, 0x81, 0x98, 0x6E, 0x2F, 0x80, 0xB8,
+    0x0A, 0x81, 0xE7, 0x00, 0x80, 0xA8, 0x80, 0x98, 0x04, 0x82, 0xFE, 0x83, 0xAA, 0x20, 0x00, 0x4B,
+    0x54, 0x81, 0xDA, 0x83, 0x35, 0x82, 0xFC, 0x82, 0xD4, 0x0B, 0x00, 0x83, 0x6B, 0x04, 0x82, 0xF4,
+    0x01, 0x51, 0x80, 0xB7, 0x82, 0x1C, 0x80, 0xC5, 0x08, 0x03, 0x81, 0x33, 0x0A, 0x80, 0x9D, 0x00,
+    0x82, 0x1D, 0x01, 0x51, 0x52, 0x80, 0x83, 0x07, 0x80, 0x94, 0x84, 0x29, 0x80, 0xB2, 0x82, 0x04,
+    0x53, 0x5B, 0x0D, 0x81, 0x93, 0x82, 0x5D, 0x01, 0x24, 0x34, 0x80, 0xB6, 0x05, 0x26, 0x2C, 0x82,
+    0x17, 0x01, 0x80, 0xDA, 0x1B, 0x51, 0x24, 0x81, 0xEB, 0x04, 0x3E, 0x01, 0x7E, 0x1B, 0x4D, 0x80,
+    0xB4, 0x04, 0x84, 0x14, 0x0A, 0x81, 0x11, 0x00, 0x4D, 0x60, 0x01, 0x2D, 0x15, 0x1B, 0x81, 0x1F,
+    0x04, 0x3E, 0x80, 0xA7, 0x05, 0x03, 0x80, 0xA9, 0x68, 0x0D, 0x80, 0xAB, 0x1B, 0x00, 0x59, 0x81,
+    0x56, 0x57, 0x01, 0x2D, 0x15, 0x1B, 0x81, 0x20, 0x04, 0x3E, 0x80, 0xA7, 0x05, 0x03, 0x80, 0xA9,
+    0x68, 0x0D, 0x80, 0xAB, 0x1B, 0x00, 0x59, 0x81, 0x56, 0x57, 0x01, 0x2D, 0x15, 0x1B, 0x81, 0x21,
+    0x04, 0x3E, 0x80, 0xA7, 0x05, 0x03, 0x80, 0xA9, 0x68, 0x0D, 0x80, 0xAB, 0x1B, 0x00, 0x59, 0x81,
+    0x56, 0x57, 0x01, 0x2D, 0x15, 0x1B, 0x81, 0x22, 0x04, 0x3E, 0x80, 0xA7, 0x05, 0x03, 0x80, 0xA9,
+    0x68, 0x0D, 0x80, 0xAB, 0x1B, 0x00, 0x59, 0x81, 0x56, 0x57, 0x01, 0x2D, 0x24, 0x04, 0x1D, 0x80,
+    0xDD, 0x81, 0xC7, 0x82, 0x2E, 0x08, 0x82, 0x36, 0x80, 0x9F, 0x0B, 0x65, 0x80, 0xF7, 0x80, 0xB1,
+    0x82, 0x59, 0x80, 0xF6, 0x80, 0x9C, 0x0B, 0x82, 0x2F, 0x82, 0x2D, 0x80, 0x86, 0x81, 0x34, 0x0A,
+    0x81, 0x4A, 0x00, 0x61, 0x08, 0x2C, 0x81, 0xF9, 0x81, 0xD5, 0x82, 0x71, 0x82, 0xEC, 0x83, 0x09,
+    0x01, 0x2D, 0x24, 0x04, 0x1D, 0x80, 0xDD, 0x81, 0xC7, 0x82, 0x2E, 0x08, 0x82, 0x36, 0x80, 0x9F,
+    0x0B, 0x65, 0x80, 0xF7, 0x80, 0xB1, 0x82, 0x59, 0x80, 0xF6, 0x80, 0x9C, 0x0B, 0x82, 0x2F, 0x82,
+    0x2D, 0x04, 0x81, 0x34, 0x0A, 0x81, 0x4A, 0x00, 0x61, 0x08, 0x2C, 0x81, 0xF9, 0x81, 0xD5, 0x82,
+    0x72, 0x01, 0x80, 0xCB, 0x04, 0x1C, 0x0A, 0x81, 0x48, 0x81, 0x5B, 0x00, 0x80, 0xCB, 0x81, 0x3D,
+    0x04, 0x28, 0x01, 0x80, 0xCB, 0x04, 0x1C, 0x0A, 0x80, 0x99, 0x55, 0x00, 0x80, 0xCB, 0x81, 0x3D,
+    0x0B, 0x43, 0x00, 0x58, 0x5C, 0x01, 0x81, 0x06, 0x5F, 0x36, 0x66, 0x15, 0x04, 0x80, 0xD7, 0x00,
+    0x15, 0x81, 0x14, 0x03, 0x80, 0x95, 0x01, 0x80, 0x8A, 0x80, 0xA8, 0x80, 0x98, 0x04, 0x2F, 0x00,
+    0x75, 0x81, 0x74, 0x0E, 0x82, 0x94, 0x01, 0x80, 0xDB, 0x04, 0x0E, 0x00, 0x83, 0x1B, 0x83, 0xF6,
+    0x09, 0x83, 0x9B, 0x82, 0xD9, 0x08, 0x00, 0x82, 0x0F, 0x82, 0x46, 0x82, 0x3D, 0x83, 0x70, 0x01,
+    0x80, 0xDB, 0x04, 0x0E, 0x00, 0x81, 0xA1, 0x1B, 0x80, 0xBE, 0x0B, 0x25, 0x83, 0xD2, 0x08, 0x1F,
+    0x80, 0xBE, 0x83, 0xCF, 0x01, 0x81, 0x07, 0x04, 0x80, 0x8A, 0x08, 0x03, 0x81, 0x9B, 0x01, 0x81,
+    0x07, 0x80, 0xC5, 0x08, 0x03, 0x83, 0x8C, 0x82, 0x51, 0x80, 0xAD, 0x6E, 0x83, 0x9A, 0x01, 0x81,
+    0xF6, 0x2D, 0x15, 0x20, 0x81, 0xD3, 0x04, 0x2F, 0x81, 0xDD, 0x00, 0x81, 0xBC, 0x81, 0x14, 0x03,
+    0x80, 0x95, 0x01, 0x32, 0x04, 0x2F, 0x81, 0x39, 0x81, 0x9A, 0x81, 0x23, 0x08, 0x00, 0x81, 0x1E,
+    0x5B, 0x84, 0x0D, 0x80, 0xD5, 0x05, 0x03, 0x80, 0xB3, 0x0E, 0x80, 0xA5, 0x83, 0x5C, 0x80, 0x9F,
+    0x05, 0x80, 0xBB, 0x27, 0x00, 0x80, 0xB3, 0x80, 0x86, 0x82, 0xC8, 0x01, 0x32, 0x04, 0x2F, 0x81,
+    0x39, 0x83, 0x80, 0x09, 0x81, 0x54, 0x08, 0x00, 0x81, 0x68, 0x76, 0x84, 0x0B, 0x83, 0xEB, 0x7B,
+    0x00, 0x80, 0xB3, 0x80, 0x86, 0x81, 0x6D, 0x09, 0x43, 0x58, 0x5C, 0x01, 0x36, 0x66, 0x15, 0x04,
+    0x2F, 0x81, 0xDD, 0x00, 0x83, 0x60, 0x80, 0xA1, 0x00, 0x81, 0xCA, 0x0B, 0x82, 0xB5, 0x05, 0x03,
+    0x1E, 0x06, 0x00, 0x15, 0x04, 0x80, 0x95, 0x01, 0x36, 0x0C, 0x81, 0xF4, 0x04, 0x3E, 0x01, 0x82,
+    0xA1, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x01, 0x81, 0x3A, 0x81, 0x06, 0x1B, 0x81, 0xC2, 0x80,
+    0xA2, 0x04, 0x71, 0x09, 0x80, 0xD1, 0x00, 0x81, 0xC2, 0x80, 0xA2, 0x54, 0x0D, 0x1F, 0x83, 0x8B,
+    0x01, 0x02, 0x81, 0x76, 0x81, 0x0E, 0x80, 0xAF, 0x5E, 0x00, 0x81, 0x0E, 0x15, 0x05, 0x03, 0x2E,
+    0x01, 0x02, 0x81, 0x76, 0x81, 0x0E, 0x80, 0xAF, 0x83, 0x68, 0x00, 0x81, 0x2B, 0x06, 0x81, 0x0E,
+    0x15, 0x05, 0x03, 0x2E, 0x01, 0x02, 0x81, 0x76, 0x80, 0xAF, 0x04, 0x71, 0x00, 0x83, 0xF2, 0x05,
+    0x03, 0x2A, 0x06, 0x00, 0x02, 0x05, 0x03, 0x84, 0x00, 0x01, 0x02, 0x80, 0xCB, 0x81, 0x3D, 0x07,
+    0x2F, 0x83, 0xC9, 0x01, 0x81, 0x3D, 0x06, 0x82, 0xDF, 0x05, 0x03, 0x1C, 0x01, 0x02, 0x80, 0xCB,
+    0x15, 0x04, 0x2E, 0x0A, 0x14, 0x56, 0x00, 0x80, 0xEF, 0x04, 0x81, 0x51, 0x80, 0xDF, 0x81, 0x3F,
+    0x01, 0x02, 0x80, 0xCB, 0x15, 0x04, 0x81, 0x96, 0x09, 0x14, 0x56, 0x00, 0x80, 0xEF, 0x04, 0x81,
+    0x51, 0x80, 0xDF, 0x81, 0x3F, 0x01, 0x02, 0x81, 0xED, 0x81, 0xEE, 0x81, 0xF2, 0x04, 0x1D, 0x82,
+    0x19, 0x01, 0x80, 0xFE, 0x0C, 0x05, 0x82, 0x23, 0x82, 0x54, 0x01, 0x02, 0x81, 0xED, 0x81, 0xEE,
+    0x81, 0xF2, 0x04, 0x1D, 0x82, 0x19, 0x01, 0x81, 0xD2, 0x0C, 0x05, 0x82, 0x23, 0x82, 0x54, 0x01,
+    0x02, 0x07, 0x0F, 0x74, 0x09, 0x53, 0x1F, 0x16, 0x7B, 0x00, 0x02, 0x04, 0x83, 0x61, 0x09, 0x82,
+    0x47, 0x82, 0x6B, 0x01, 0x02, 0x81, 0x44, 0x0E, 0x00, 0x81, 0x18, 0x6E, 0x2F, 0x82, 0x02, 0x81,
+    0x23, 0x08, 0x00, 0x81, 0x1E, 0x5B, 0x81, 0xAB, 0x01, 0x02, 0x20, 0x00, 0x39, 0x81, 0x0A, 0x05,
+    0x03, 0x21, 0x06, 0x1C, 0x01, 0x80, 0xB4, 0x83, 0x7A, 0x04, 0x2F, 0x83, 0xFC, 0x0A, 0x83, 0xCC,
+    0x0B, 0x6C, 0x00, 0x80, 0xAD, 0x60, 0x01, 0x80, 0xF2, 0x80, 0xB5, 0x80, 0xDC, 0x81, 0x0B, 0x83,
+    0xBF, 0x82, 0xC4, 0x01, 0x80, 0xDC, 0x83, 0xD5, 0x05, 0x03, 0x81, 0x8F, 0x01, 0x80, 0xC1, 0x81,
+    0x7C, 0x1B, 0x00, 0x81, 0x18, 0x81, 0xFC, 0x82, 0x2C, 0x01, 0x4B, 0x81, 0xD6, 0x15, 0x80, 0x8A,
+    0x81, 0x5E, 0x81, 0x30, 0x81, 0x3B, 0x01, 0x15, 0x05, 0x03, 0x81, 0x15, 0x06, 0x00, 0x81, 0x29,
+    0x80, 0xC1, 0x80, 0xB9, 0x05, 0x03, 0x80, 0x95, 0x01, 0x4B, 0x07, 0x84, 0x28, 0x80, 0xB2, 0x82,
+    0x04, 0x53, 0x5B, 0x0D, 0x81, 0x93, 0x82, 0x5D, 0x01, 0x24, 0x34, 0x80, 0xB6, 0x05, 0x03, 0x3E,
+    0x01, 0x4B, 0x24, 0x04, 0x71, 0x00, 0x52, 0x04, 0x81, 0x0C, 0x80, 0xBC, 0x01, 0x4B, 0x24, 0x04,
+    0x71, 0x00, 0x52, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x01, 0x4B, 0x24, 0x04, 0x71, 0x00, 0x52,
+    0x05, 0x26, 0x2C, 0x80, 0x97, 0x82, 0xF0, 0x06, 0x00, 0x81, 0x5C, 0x82, 0x56, 0x05, 0x03, 0x81,
+    0x9B, 0x01, 0x4B, 0x24, 0x04, 0x71, 0x00, 0x15, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x01, 0x4B,
+    0x24, 0x04, 0x71, 0x00, 0x15, 0x05, 0x26, 0x2C, 0x80, 0x97, 0x57, 0x01, 0x81, 0x8D, 0x80, 0xD0,
+    0x04, 0x2F, 0x81, 0xDF, 0x81, 0x08, 0x80, 0xB2, 0x80, 0xC3, 0x82, 0x33, 0x0A, 0x80, 0x9D, 0x06,
+    0x80, 0xD1, 0x4B, 0x27, 0x80, 0xA5, 0x80, 0xDE, 0x81, 0xDB, 0x82, 0x3F, 0x01, 0x81, 0x8D, 0x80,
+    0xD0, 0x04, 0x2F, 0x82, 0x20, 0x0A, 0x14, 0x27, 0x79, 0x81, 0x05, 0x06, 0x59, 0x80, 0x9E, 0x04,
+    0x82, 0x29, 0x01, 0x81, 0x8D, 0x80, 0xD0, 0x82, 0x1F, 0x04, 0x1D, 0x82, 0x66, 0x0A, 0x14, 0x27,
+    0x00, 0x4B, 0x04, 0x81, 0x33, 0x01, 0x83, 0x43, 0x24, 0x34, 0x04, 0x80, 0xD7, 0x00, 0x81, 0x63,
+    0x80, 0xA2, 0x05, 0x03, 0x80, 0x95, 0x01, 0x83, 0x46, 0x80, 0xCD, 0x3D, 0x04, 0x3E, 0x01, 0x82,
+    0x26, 0x83, 0xA3, 0x04, 0x2E, 0x01, 0x0C, 0x81, 0xF4, 0x04, 0x83, 0x90, 0x82, 0x9C, 0x83, 0xBA,
+    0x05, 0x03, 0x81, 0x45, 0x06, 0x83, 0x57, 0x81, 0x31, 0x80, 0xCD, 0x05, 0x03, 0x72, 0x01, 0x0C,
+    0x83, 0xE1, 0x4A, 0x01, 0x4C, 0x83, 0x0E, 0x0E, 0x81, 0xA9, 0x80, 0xB4, 0x04, 0x2F, 0x81, 0xE8,
+    0x54, 0x00, 0x2D, 0x4C, 0x83, 0xE9, 0x80, 0xA7, 0x80, 0xB4, 0x81, 0x77, 0x03, 0x83, 0xB0, 0x01,
+    0x4C, 0x80, 0xCD, 0x3D, 0x04, 0x3E, 0x01, 0x4C, 0x04, 0x5D, 0x81, 0x5F, 0x54, 0x83, 0x2C, 0x0A,
+    0x81, 0xE2, 0x80, 0xA5, 0x80, 0xAD, 0x0B, 0x80, 0x9D, 0x00, 0x4C, 0x81, 0xD7, 0x08, 0x00, 0x81,
+    0xD8, 0x82, 0x53, 0x06, 0x81, 0x16, 0x80, 0xC6, 0x80, 0xD8, 0x08, 0x80, 0xBB, 0x00, 0x4D, 0x60,
+    0x01, 0x4C, 0x04, 0x5D, 0x54, 0x16, 0x01, 0x4C, 0x04, 0x80, 0xED, 0x01, 0x4C, 0x04, 0x81, 0x05,
+    0x54, 0x81, 0xFE, 0x06, 0x00, 0x80, 0xA8, 0x80, 0x98, 0x04, 0x82, 0x12, 0x83, 0x4D, 0x0A, 0x81,
+    0xE2, 0x80, 0xA5, 0x80, 0xAD, 0x0B, 0x80, 0x9D, 0x00, 0x4C, 0x06, 0x81, 0x6F, 0x00, 0x80, 0xA8,
+    0x80, 0x98, 0x81, 0xD7, 0x08, 0x00, 0x81, 0xD8, 0x82, 0x53, 0x06, 0x81, 0x16, 0x80, 0xC6, 0x80,
+    0xD8, 0x08, 0x80, 0xBB, 0x00, 0x4D, 0x60, 0x01, 0x4C, 0x04, 0x81, 0x05, 0x54, 0x81, 0xFE, 0x06,
+    0x00, 0x80, 0xA8, 0x80, 0x98, 0x04, 0x82, 0x38, 0x0E, 0x83, 0x00, 0x01, 0x4C, 0x24, 0x34, 0x04,
+    0x71, 0x00, 0x81, 0x8E, 0x80, 0xB9, 0x05, 0x2F, 0x03, 0x82, 0x13, 0x7B, 0x80, 0x9F, 0x84, 0x22,
+    0x08, 0x82, 0x09, 0x00, 0x81, 0x8E, 0x80, 0xB9, 0x81, 0xBD, 0x73, 0x81, 0x2A, 0x83, 0x50, 0x09,
+    0x82, 0x60, 0x20, 0x83, 0x6A, 0x83, 0x73, 0x20, 0x00, 0x80, 0xF8, 0x83, 0x91, 0x01, 0x4C, 0x24,
+    0x04, 0x3E, 0x82, 0xB7, 0x34, 0x80, 0xB6, 0x05, 0x26, 0x2C, 0x82, 0x17, 0x01, 0x4C, 0x24, 0x04,
+    0x71, 0x00, 0x52, 0x04, 0x81, 0x0C, 0x80, 0xBC, 0x01, 0x4C, 0x24, 0x04, 0x71, 0x00, 0x52, 0x05,
+    0x26, 0x0D, 0x80, 0xA4, 0x57, 0x01, 0x4C, 0x24, 0x04, 0x71, 0x00, 0x52, 0x05, 0x26, 0x2C, 0x80,
+    0x97, 0x57, 0x01, 0x4C, 0x24, 0x04, 0x71, 0x00, 0x15, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x0A,
+    0x14, 0x56, 0x00, 0x80, 0xEF, 0x04, 0x81, 0x51, 0x80, 0xDF, 0x81, 0x3F, 0x01, 0x4C, 0x24, 0x04,
+    0x71, 0x00, 0x15, 0x05, 0x26, 0x2C, 0x80, 0x97, 0x57, 0x01, 0x81, 0x0E, 0x15, 0x1B, 0x36, 0x0C,
+    0x04, 0x3E, 0x01, 0x15, 0x80, 0xAF, 0x81, 0xBC, 0x05, 0x03, 0x2F, 0x81, 0x51, 0x80, 0xDF, 0x81,
+    0x3F, 0x01, 0x4D, 0x80, 0xB4, 0x04, 0x2F, 0x82, 0xDB, 0x0A, 0x14, 0x08, 0x62, 0x27, 0x00, 0x81,
+    0xB0, 0x82, 0x26, 0x07, 0x80, 0x94, 0x83, 0xCB, 0x01, 0x4D, 0x80, 0xB4, 0x04, 0x84, 0x10, 0x01,
+    0x61, 0x81, 0x77, 0x83, 0xC0, 0x1F, 0x4D, 0x81, 0x43, 0x64, 0x81, 0x10, 0x82, 0xA9, 0x81, 0x71,
+    0x00, 0x2D, 0x4D, 0x83, 0x2F, 0x01, 0x61, 0x07, 0x82, 0xD5, 0x80, 0x94, 0x82, 0xE2, 0x0A, 0x84,
+    0x11, 0x73, 0x0B, 0x6D, 0x80, 0xA0, 0x01, 0x61, 0x81, 0xB4, 0x55, 0x82, 0x64, 0x5B, 0x00, 0x4C,
+    0x08, 0x82, 0xFB, 0x83, 0x16, 0x80, 0xCA, 0x83, 0x42, 0x01, 0x81, 0x55, 0x80, 0xF8, 0x83, 0x13,
+    0x2F, 0x83, 0x6D, 0x00, 0x82, 0x34, 0x09, 0x14, 0x00, 0x83, 0xB1, 0x81, 0x55, 0x82, 0x4B, 0x01,
+    0x81, 0x12, 0x1B, 0x81, 0x1F, 0x04, 0x80, 0xD7, 0x00, 0x0C, 0x05, 0x26, 0x4A, 0x01, 0x81, 0x12,
+    0x1B, 0x81, 0x20, 0x04, 0x80, 0xD7, 0x00, 0x0C, 0x05, 0x26, 0x4A, 0x01, 0x81, 0x12, 0x1B, 0x81,
+    0x21, 0x04, 0x80, 0xD7, 0x00, 0x0C, 0x05, 0x26, 0x4A, 0x01, 0x81, 0x12, 0x1B, 0x81, 0x22, 0x04,
+    0x80, 0xD7, 0x00, 0x0C, 0x05, 0x26, 0x4A, 0x01, 0x81, 0x13, 0x81, 0x09, 0x1B, 0x00, 0x80, 0xFE,
+    0x80, 0x9C, 0x81, 0xF0, 0x82, 0x06, 0x5F, 0x82, 0x1A, 0x81, 0xE1, 0x0A, 0x80, 0x9D, 0x00, 0x81,
+    0x78, 0x81, 0xA4, 0x0B, 0x82, 0x40, 0x00, 0x81, 0x47, 0x81, 0x02, 0x81, 0xD9, 0x01, 0x81, 0x13,
+    0x81, 0x09, 0x1B, 0x00, 0x80, 0xFE, 0x80, 0x9C, 0x04, 0x80, 0xDD, 0x01, 0x80, 0xFA, 0x80, 0xEB,
+    0x05, 0x03, 0x81, 0x46, 0x01, 0x81, 0x13, 0x81, 0x09, 0x1B, 0x00, 0x80, 0xFF, 0x80, 0x9C, 0x81,
+    0xF0, 0x82, 0x06, 0x5F, 0x00, 0x82, 0x1A, 0x81, 0xE1, 0x0A, 0x80, 0x9D, 0x00, 0x81, 0x78, 0x81,
+    0xA4, 0x0B, 0x82, 0x40, 0x00, 0x81, 0x47, 0x81, 0x02, 0x81, 0xD9, 0x01, 0x81, 0x13, 0x81, 0x09,
+    0x1B, 0x00, 0x80, 0xFF, 0x80, 0x9C, 0x04, 0x80, 0xDD, 0x01, 0x80, 0xFA, 0x80, 0xEB, 0x05, 0x03,
+    0x81, 0x46, 0x01, 0x81, 0x57, 0x04, 0x81, 0x96, 0x09, 0x6C, 0x00, 0x80, 0xC0, 0x01, 0x82, 0x49,
+    0x1B, 0x81, 0xD3, 0x81, 0xF6, 0x2D, 0x15, 0x04, 0x1D, 0x80, 0xDD, 0x01, 0x82, 0x49, 0x1B, 0x00,
+    0x36, 0x66, 0x15, 0x04, 0x81, 0x94, 0x00, 0x4C, 0x05, 0x2F, 0x82, 0x12, 0x81, 0xEC, 0x01, 0x80,
+    0xAF, 0x1B, 0x4B, 0x66, 0x15, 0x80, 0x83, 0x04, 0x1D, 0x80, 0xE2, 0x01, 0x81, 0x80, 0x80, 0x9E,
+    0x08, 0x00, 0x15, 0x05, 0x03, 0x80, 0x95, 0x01, 0x80, 0xAF, 0x1B, 0x4B, 0x66, 0x15, 0x80, 0x83,
+    0x04, 0x80, 0xE2, 0x01, 0x66, 0x15, 0x05, 0x03, 0x1E, 0x06, 0x26, 0x81, 0x9F, 0x81, 0x7F, 0x80,
+    0xAA, 0x01, 0x80, 0xAF, 0x1B, 0x4B, 0x66, 0x15, 0x80, 0x93, 0x04, 0x1D, 0x80, 0xE2, 0x01, 0x81,
+    0x80, 0x80, 0x9E, 0x08, 0x00, 0x15, 0x05, 0x03, 0x80, 0x95, 0x01, 0x80, 0xAF, 0x1B, 0x4B, 0x66,
+    0x15, 0x80, 0x93, 0x04, 0x80, 0xE2, 0x01, 0x66, 0x15, 0x05, 0x03, 0x1E, 0x06, 0x26, 0x81, 0x9F,
+    0x81, 0x7F, 0x80, 0xAA, 0x01, 0x80, 0xAF, 0x1B, 0x4B, 0x66, 0x15, 0x80, 0xC8, 0x04, 0x1D, 0x80,
+    0xE2, 0x01, 0x81, 0x80, 0x80, 0x9E, 0x08, 0x00, 0x15, 0x05, 0x03, 0x80, 0x95, 0x01, 0x80, 0xAF,
+    0x1B, 0x4B, 0x66, 0x15, 0x80, 0xC8, 0x04, 0x80, 0xE2, 0x01, 0x66, 0x15, 0x05, 0x03, 0x1E, 0x06,
+    0x26, 0x81, 0x9F, 0x81, 0x7F, 0x80, 0xAA, 0x01, 0x80, 0xAF, 0x1B, 0x00, 0x4B, 0x81, 0xD6, 0x15,
+    0x04, 0x80, 0xE2, 0x01, 0x15, 0x05, 0x26, 0x81, 0x86, 0x82, 0x2B, 0x06, 0x80, 0x94, 0x72, 0x01,
+    0x82, 0x4D, 0x83, 0xB7, 0x07, 0x2F, 0x80, 0x94, 0x84, 0x18, 0x5B, 0x0D, 0x81, 0x93, 0x84, 0x05,
+    0x0B, 0x00, 0x80, 0xAD, 0x84, 0x01, 0x07, 0x83, 0x21, 0x0A, 0x81, 0xE7, 0x00, 0x81, 0x9C, 0x0B,
+    0x83, 0xC6, 0x81, 0x10, 0x01, 0x3D, 0x1B, 0x00, 0x4C, 0x80, 0xCD, 0x04, 0x82, 0x50, 0x80, 0x9A,
+    0x05, 0x03, 0x2A, 0x0B, 0x83, 0x7C, 0x82, 0xF2, 0x01, 0x3D, 0x1B, 0x00, 0x4C, 0x80, 0xCD, 0x04,
+    0x1D, 0x81, 0xAA, 0x06, 0x80, 0xF9, 0x80, 0x9A, 0x05, 0x03, 0x2A, 0x06, 0x00, 0x80, 0xEF, 0x04,
+    0x2F, 0x80, 0xDF, 0x0E, 0x81, 0x52, 0x01, 0x3D, 0x1B, 0x00, 0x4C, 0x80, 0xCD, 0x04, 0x1D, 0x81,
+    0xAA, 0x06, 0x80, 0xF9, 0x80, 0x9A, 0x05, 0x03, 0x2A, 0x06, 0x00, 0x80, 0xEF, 0x05, 0x2F, 0x03,
+    0x80, 0xDF, 0x0E, 0x81, 0x52, 0x01, 0x3D, 0x1B, 0x00, 0x83, 0x95, 0x81, 0x31, 0x80, 0xCD, 0x04,
+    0x1D, 0x81, 0xAA, 0x06, 0x80, 0xF9, 0x80, 0x9A, 0x05, 0x03, 0x2A, 0x06, 0x00, 0x80, 0xEF, 0x04,
+    0x2F, 0x80, 0xDF, 0x0E, 0x81, 0x52, 0x01, 0x80, 0xB6, 0x83, 0x14, 0x2F, 0x83, 0xFB, 0x00, 0x80,
+    0xB4, 0x80, 0xB6, 0x83, 0x01, 0x84, 0x1B, 0x68, 0x00, 0x7C, 0x80, 0xC9, 0x81, 0x79, 0x0A, 0x80,
+    0xD1, 0x00, 0x7C, 0x80, 0xC9, 0x80, 0xD9, 0x06, 0x80, 0xF3, 0x00, 0x2D, 0x7C, 0x80, 0xC9, 0x80,
+    0xD9, 0x08, 0x82, 0x93, 0x01, 0x80, 0xB6, 0x84, 0x21, 0x04, 0x84, 0x15, 0x84, 0x0A, 0x00, 0x80,
+    0xE0, 0x80, 0xAB, 0x83, 0xB8, 0x83, 0x38, 0x01, 0x24, 0x0B, 0x83, 0x47, 0x15, 0x07, 0x2C, 0x35,
+    0x01, 0x80, 0xEC, 0x05, 0x03, 0x23, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80, 0x83, 0x04, 0x3E, 0x01,
+    0x81, 0x63, 0x80, 0xA2, 0x05, 0x03, 0x80, 0x95, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80, 0x83, 0x04,
+    0x3E, 0x01, 0x52, 0x04, 0x81, 0x0C, 0x80, 0xBC, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80, 0x83, 0x04,
+    0x3E, 0x01, 0x52, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80, 0x83,
+    0x04, 0x3E, 0x01, 0x52, 0x05, 0x26, 0x2C, 0x80, 0x97, 0x78, 0x06, 0x00, 0x81, 0x5C, 0x82, 0x05,
+    0x05, 0x26, 0x83, 0xFF, 0x81, 0xF7, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80, 0x83, 0x04, 0x3E, 0x01,
+    0x15, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80, 0x83, 0x04, 0x3E,
+    0x01, 0x15, 0x05, 0x26, 0x2C, 0x80, 0x97, 0x57, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80, 0x93, 0x04,
+    0x3E, 0x01, 0x81, 0x63, 0x80, 0xA2, 0x05, 0x03, 0x80, 0x95, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80,
+    0x93, 0x04, 0x3E, 0x01, 0x52, 0x04, 0x81, 0x0C, 0x80, 0xBC, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80,
+    0x93, 0x04, 0x3E, 0x01, 0x52, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x01, 0x24, 0x1B, 0x51, 0x52,
+    0x80, 0x93, 0x04, 0x3E, 0x01, 0x52, 0x05, 0x26, 0x2C, 0x80, 0x97, 0x78, 0x06, 0x00, 0x81, 0x5C,
+    0x82, 0x05, 0x05, 0x03, 0x0E, 0x81, 0xF7, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80, 0x93, 0x04, 0x3E,
+    0x01, 0x15, 0x05, 0x26, 0x0D, 0x80, 0xA4, 0x57, 0x01, 0x24, 0x1B, 0x51, 0x52, 0x80, 0x93, 0x04,
+    0x3E, 0x01, 0x15, 0x05, 0x26, 0x2C, 0x80, 0x97, 0x57, 0x01, 0x24, 0x1B, 0x00, 0x83, 0x3F, 0x81,
+    0x01, 0x81, 0x82, 0x00, 0x82, 0x1E, 0x0B, 0x7D, 0x82, 0xCD, 0x08, 0x00, 0x82, 0x1E, 0x80, 0xBC,
+    0x01, 0x81, 0x18, 0x04, 0x2E, 0x0A, 0x6C, 0x00, 0x80, 0xC0, 0x01, 0x81, 0xB9, 0x1B, 0x36, 0x66,
+    0x15, 0x04, 0x81, 0x94, 0x00, 0x4C, 0x80, 0xC5, 0x08, 0x2F, 0x03, 0x82, 0x13, 0x01, 0x81, 0xBA,
+    0x80, 0xD0, 0x04, 0x2F, 0x81, 0xDF, 0x81, 0x08, 0x80, 0xB2, 0x80, 0xC3, 0x82, 0x33, 0x0A, 0x80,
+    0x9D, 0x06, 0x80, 0xD1, 0x4B, 0x27, 0x80, 0xA5, 0x80, 0xDE, 0x81, 0xDB, 0x82, 0x3F, 0x01, 0x81,
+    0xBA, 0x80, 0xD0, 0x04, 0x2F, 0x82, 0x20, 0x0A, 0x14, 0x27, 0x79, 0x81, 0x05, 0x06, 0x59, 0x80,
+    0x9E, 0x04, 0x82, 0x29, 0x01, 0x81, 0xBA, 0x80, 0xD0, 0x82, 0x1F, 0x04, 0x1D, 0x82, 0x66, 0x0A,
+    0x14, 0x27, 0x00, 0x4B, 0x04, 0x81, 0x33, 0x80, 0xD5, 0x04, 0x2F, 0x81, 0x08, 0x82, 0x03, 0x81,
+    0xB0, 0x81, 0xAD, 0x5B, 0x00, 0x4D, 0x60, 0x0A, 0x80, 0xF3, 0x06, 0x80, 0x9D, 0x80, 0xA6, 0x80,
+    0xD9, 0x08, 0x82, 0x3E, 0x81, 0x75, 0x81, 0xAE, 0x80, 0xD5, 0x04, 0x2F, 0x81, 0x08, 0x82, 0x03,
+    0x81, 0xB0, 0x81, 0xAD, 0x5B, 0x00, 0x4D, 0x60, 0x82, 0xAA, 0x08, 0x81, 0x3A, 0x80, 0xF8, 0x80,
+    0x96, 0x82, 0x3E, 0x81, 0x75, 0x81, 0xAE, 0x80, 0xD5, 0x6E, 0x0D, 0x83, 0xB4, 0x83, 0x17, 0x0D,
+    0x81, 0x88, 0x0A, 0x14, 0x80, 0x9F, 0x80, 0xAC, 0x80, 0x9E, 0x0B, 0x81, 0x11, 0x00, 0x80, 0xAD,
+    0x60, 0x80, 0xD5, 0x6E, 0x2C, 0x84, 0x12, 0x4D, 0x81, 0x42, 0x81, 0x1B, 0x00, 0x61, 0x83, 0x67,
+    0x83, 0xAB, 0x7B, 0x00, 0x81, 0x99, 0x04, 0x80, 0xD2, 0x82, 0xCC, 0x08, 0x00, 0x80, 0xA8, 0x83,
+    0xA6, 0x80, 0x9F, 0x80, 0x96, 0x6D, 0x83, 0xD8, 0x00, 0x4D, 0x60, 0x82, 0xB8, 0x83, 0xFD, 0x4A,
+    0x81, 0xCF, 0x04, 0x2F, 0x81, 0x5A, 0x50, 0x80, 0xE7, 0x83, 0xE4, 0x04, 0x83, 0xE6, 0x08, 0x82,
+    0x68, 0x83, 0x82, 0x81, 0xCF, 0x04, 0x2F, 0x81, 0x5A, 0x50, 0x82, 0xAF, 0x84, 0x1E, 0x04, 0x83,
+    0x19, 0x0E, 0x82, 0x4D, 0x83, 0xAC, 0x81, 0xD0, 0x3F, 0x22, 0x83, 0x2B, 0x0A, 0x14, 0x27, 0x00,
+    0x02, 0x04, 0x2A, 0x06, 0x00, 0x32, 0x04, 0x80, 0xED, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58, 0x5C,
+    0x81, 0xD0, 0x64, 0x3F, 0x22, 0x16, 0x0A, 0x14, 0x27, 0x00, 0x02, 0x04, 0x2A, 0x06, 0x00, 0x32,
+    0x80, 0xED, 0x76, 0x80, 0x80, 0x43, 0x00, 0x58, 0x5C, 0x82, 0xBA, 0x80, 0xC1, 0x81, 0x7C, 0x81,
+    0xFC, 0x82, 0x2C, 0x0A, 0x83, 0xCA, 0x00, 0x80, 0xC1, 0x81, 0x7C, 0x0B, 0x14, 0x08, 0x81, 0x48,
+    0x81, 0x5B, 0x65, 0x4D, 0x04, 0x83, 0x3B, 0x83, 0x8A, 0x81, 0xD1, 0x80, 0xB7, 0x04, 0x2E, 0x81,
+    0xD1, 0x80, 0xB7, 0x04, 0x2F, 0x81, 0x7A, 0x0A, 0x14, 0x82, 0x62, 0x80, 0xB7, 0x81, 0x2B, 0x80,
+    0xAA, 0x81, 0x6C, 0x08, 0x80, 0xCE, 0x02, 0x80, 0xCF, 0x00, 0x80, 0xA3, 0x80, 0xA7, 0x81, 0x32,
+    0x03, 0x80, 0xCC, 0x08, 0x81, 0x81, 0x02, 0x06, 0x0D, 0x2A, 0x81, 0xAF, 0x81, 0x6C, 0x08, 0x80,
+    0xCE, 0x02, 0x80, 0xCF, 0x00, 0x80, 0xA3, 0x80, 0xA7, 0x81, 0x32, 0x03, 0x80, 0xCC, 0x08, 0x81,
+    0x81, 0x02, 0x06, 0x0D, 0x2A, 0x81, 0xAF, 0x7B, 0x82, 0x2A, 0x09, 0x14, 0x27, 0x00, 0x4F, 0x5A,
+    0x81, 0x5D, 0x04, 0x81, 0x7A, 0x81, 0x6C, 0x08, 0x83, 0xC1, 0x84, 0x06, 0x83, 0xA0, 0x81, 0xBD,
+    0x80, 0xA6, 0x80, 0xD9, 0x83, 0x4E, 0x82, 0xBC, 0x84, 0x1C, 0x09, 0x14, 0x65, 0x81, 0x6E, 0x82,
+    0x10, 0x82, 0xBD, 0x80, 0xA6, 0x82, 0x85, 0x09, 0x80, 0xF3, 0x81, 0x41, 0x82, 0xBE, 0x4D, 0x80,
+    0xB4, 0x83, 0x98, 0x06, 0x83, 0x7B, 0x0A, 0x81, 0x11, 0x00, 0x80, 0xAD, 0x60, 0x82, 0xC0, 0x59,
+    0x5E, 0x09, 0x82, 0x60, 0x83, 0x88, 0x82, 0xBF, 0x06, 0x6C, 0x00, 0x80, 0xC0, 0x80, 0xFE, 0x80,
+    0x9C, 0x80, 0xC3, 0x81, 0x00, 0x09, 0x14, 0x27, 0x00, 0x37, 0x81, 0x8A, 0x04, 0x2A, 0x06, 0x00,
+    0x81, 0x78, 0x81, 0xA4, 0x07, 0x1D, 0x82, 0x28, 0x82, 0x41, 0x80, 0xFE, 0x80, 0x9C, 0x80, 0xC3,
+    0x81, 0x00, 0x00, 0x80, 0xFA, 0x80, 0xEB, 0x05, 0x03, 0x81, 0x46, 0x80, 0xFF, 0x80, 0x9C, 0x80,
+    0xC3, 0x81, 0x00, 0x09, 0x14, 0x27, 0x00, 0x37, 0x81, 0x8A, 0x04, 0x2A, 0x06, 0x00, 0x80, 0xFF,
+    0x82, 0xEB, 0x07, 0x1D, 0x82, 0x28, 0x82, 0x41, 0x80, 0xFF, 0x80, 0x9C, 0x80, 0xC3, 0x81, 0x00,
+    0x00, 0x80, 0xFA, 0x80, 0xEB, 0x05, 0x03, 0x81, 0x46, 0x80, 0xE8, 0x81, 0x64, 0x81, 0x55, 0x04,
+    0x2F, 0x83, 0x6E, 0x54, 0x65, 0x82, 0x34, 0x09, 0x81, 0xF3, 0x00, 0x81, 0x64, 0x0E, 0x00, 0x82,
+    0xFF, 0x81, 0x55, 0x0B, 0x83, 0xC5, 0x65, 0x81, 0x6E, 0x80, 0xA0, 0x80, 0xE8, 0x4C, 0x80, 0xC5,
+    0x08, 0x03, 0x81, 0x05, 0x54, 0x83, 0x58, 0x06, 0x5D, 0x82, 0x24, 0x80, 0xE8, 0x61, 0x04, 0x0E,
+    0x81, 0x3A, 0x83, 0x74, 0x0A, 0x80, 0xF0, 0x82, 0xB6, 0x82, 0xB3, 0x80, 0xE8, 0x61, 0x80, 0xC5,
+    0x08, 0x03, 0x80, 0xAD, 0x81, 0xBD, 0x83, 0x25, 0x80, 0xE8, 0x81, 0xA9, 0x80, 0xB4, 0x04, 0x2F,
+    0x82, 0xF8, 0x54, 0x2D, 0x61, 0x82, 0x27, 0x80, 0xA7, 0x80, 0xB4, 0x81, 0x77, 0x03, 0x81, 0xA0,
+    0x20, 0x80, 0xA5, 0x80, 0xF7, 0x80, 0xE8, 0x81, 0xA9, 0x80, 0xB4, 0x04, 0x2F, 0x81, 0xE8, 0x54,
+    0x00, 0x2D, 0x61, 0x82, 0x27, 0x82, 0x8B, 0x82, 0xDD, 0x80, 0xBF, 0x73, 0x04, 0x80, 0xC4, 0x83,
+    0x0C, 0x80, 0xBF, 0x73, 0x04, 0x80, 0xC4, 0x83, 0x0D, 0x80, 0xBF, 0x73, 0x04, 0x80, 0xC4, 0x81,
+    0x89, 0x80, 0xBF, 0x73, 0x04, 0x80, 0xC4, 0x83, 0x55, 0x80, 0xBF, 0x73, 0x04, 0x80, 0xC4, 0x83,
+    0xC2, 0x80, 0xBF, 0x73, 0x04, 0x80, 0xC4, 0x82, 0x46, 0x80, 0xBF, 0x73, 0x04, 0x80, 0xC4, 0x84,
+    0x19, 0x80, 0xBF, 0x73, 0x04, 0x80, 0xC4, 0x84, 0x2B, 0x80, 0xBF, 0x73, 0x04, 0x80, 0xC4
+};
+
+static const uint16_t HMS_DB_WORD_OFFSETS[HMS_DB_NUM_WORDS + 1] = {
+    0, 3, 6, 14, 16, 18, 21, 23, 26, 28, 34, 40,
+    43, 48, 49, 51, 54, 58, 62, 66, 70, 75, 81, 90,
+    95, 100, 105, 110, 112, 118, 121, 127, 130, 132, 139, 142,
+    149, 160, 166, 170, 172, 176, 187, 192, 198, 200, 207, 222,
+    225, 231, 239, 247, 251, 258, 264, 273, 277, 285, 290, 295,
+    301, 306, 311, 320, 327, 333, 338, 349, 354, 363, 374, 389,
+    393, 397, 401, 408, 415, 421, 426, 434, 437, 444, 451, 457,
+    461, 465, 468, 475, 483, 490, 498, 502, 505, 512, 519, 525,
+    529, 533, 540, 543, 552, 557, 561, 566, 570, 572, 579, 585,
+    593, 600, 603, 606, 610, 617, 626, 634, 636, 640, 644, 649,
+    655, 662, 666, 670, 672, 677, 690, 697, 707, 723, 728, 733,
+    734, 741, 743, 746, 753, 757, 764, 772, 779, 784, 789, 794,
+    799, 804, 812, 817, 818, 822, 829, 832, 836, 841, 845, 847,
+    850, 854, 859, 869, 872, 878, 885, 890, 899, 904, 908, 915,
+    919, 924, 930, 941, 948, 955, 963, 969, 975, 980, 988, 990,
+    997, 1001, 1006, 1012, 1018, 1027, 1030, 1036, 1042, 1054, 1060, 1067,
+    1076, 1083, 1088, 1095, 1101, 1112, 1117, 1125, 1126, 1127, 1129, 1135,
+    1141, 1144, 1147, 1151, 1155, 1160, 1167, 1172, 1176, 1181, 1186, 1187,
+    1196, 1202, 1206, 1219, 1225, 1235, 1239, 1246, 1253, 1258, 1263, 1268,
+    1269, 1274, 1281, 1289, 1294, 1298, 1301, 1305, 1309, 1313, 1321, 1327,
+    1336, 1343, 1348, 1353, 1359, 1367, 1373, 1379, 1387, 1395, 1403, 1409,
+    1414, 1416, 1418, 1419, 1420, 1429, 1432, 1443, 1447, 1460, 1467, 1471,
+    1475, 1481, 1490, 1496, 1502, 1506, 1515, 1523, 1529, 1538, 1544, 1554,
+    1563, 1569, 1575, 1578, 1582, 1590, 1595, 1599, 1603, 1607, 1608, 1617,
+    1624, 1631, 1638, 1645, 1650, 1657, 1664, 1671, 1678, 1681, 1687, 1692,
+    1697, 1703, 1708, 1714, 1721, 1731, 1738, 1743, 1749, 1758, 1767, 1778,
+    1788, 1796, 1805, 1812, 1818, 1821, 1827, 1834, 1837, 1848, 1851, 1854,
+    1858, 1866, 1872, 1878, 1885, 1889, 1894, 1898, 1906, 1913, 1920, 1929,
+    1942, 1949, 1957, 1966, 1973, 1978, 1984, 1992, 1998, 2012, 2018, 2027,
+    2031, 2038, 2042, 2052, 2054, 2062, 2065, 2065, 2067, 2070, 2076, 2084,
+    2089, 2093, 2099, 2105, 2114, 2120, 2131, 2138, 2144, 2153, 2158, 2165,
+    2168, 2170, 2179, 2185, 2190, 2196, 2201, 2211, 2220, 2225, 2233, 2239,
+    2247, 2257, 2266, 2273, 2283, 2290, 2298, 2304, 2313, 2318, 2325, 2329,
+    2337, 2342, 2352, 2355, 2366, 2375, 2380, 2385, 2389, 2393, 2405, 2420,
+    2427, 2433, 2438, 2447, 2452, 2462, 2468, 2473, 2477, 2484, 2491, 2494,
+    2500, 2503, 2508, 2518, 2522, 2530, 2536, 2540, 2550, 2559, 2564, 2570,
+    2576, 2583, 2589, 2597, 2603, 2608, 2613, 2620, 2625, 2631, 2636, 2644,
+    2648, 2652, 2659, 2667, 2668, 2670, 2674, 2676, 2681, 2688, 2695, 2697,
+    2699, 2707, 2713, 2715, 2726, 2730, 2737, 2743, 2752, 2759, 2762, 2764,
+    2770, 2775, 2780, 2792, 2801, 2807, 2817, 2820, 2827, 2836, 2846, 2854,
+    2860, 2869, 2881, 2887, 2893, 2901, 2905, 2910, 2917, 2927, 2935, 2945,
+    2955, 2965, 2973, 2980, 2989, 2996, 3005, 3013, 3021, 3027, 3033, 3037,
+    3044, 3050, 3061, 3070, 3077, 3081, 3091, 3101, 3109, 3114, 3121, 3127,
+    3131, 3135, 3139, 3146, 3150, 3155, 3159, 3165, 3172, 3179, 3188, 3195,
+    3206, 3218, 3223, 3232, 3242, 3254, 3267, 3280, 3286, 3290, 3296, 3300,
+    3304, 3308, 3313, 3318, 3322, 3326, 3332, 3344, 3348, 3357, 3363, 3368,
+    3374, 3378, 3385, 3389, 3392, 3396, 3406, 3411, 3416, 3422, 3426, 3431,
+    3440, 3448, 3457, 3464, 3468, 3471, 3478, 3487, 3496, 3505, 3512, 3519,
+    3530, 3535, 3546, 3554, 3567, 3572, 3576, 3584, 3590, 3594, 3605, 3612,
+    3621, 3626, 3633, 3640, 3648, 3653, 3655, 3664, 3671, 3677, 3684, 3690,
+    3696, 3702, 3707, 3712, 3724, 3728, 3733, 3745, 3750, 3754, 3759, 3764,
+    3777, 3784, 3788, 3793, 3801, 3804, 3810, 3817, 3826, 3834, 3842, 3849,
+    3850, 3852, 3854, 3860, 3862, 3864, 3867, 3872, 3877, 3882, 3887, 3897,
+    3905, 3912, 3925, 3929, 3932, 3937, 3939, 3942, 3953, 3958, 3963, 3968,
+    3973, 3981, 3986, 3992, 4001, 4008, 4012, 4016, 4024, 4032, 4042, 4051,
+    4057, 4064, 4069, 4074, 4082, 4086, 4092, 4095, 4105, 4108, 4111, 4119,
+    4127, 4130, 4136, 4146, 4148, 4151, 4154, 4156, 4161, 4173, 4179, 4188,
+    4194, 4200, 4208, 4215, 4221, 4229, 4238, 4250, 4258, 4273, 4275, 4284,
+    4295, 4299, 4301, 4309, 4314, 4326, 4337, 4348, 4352, 4360, 4368, 4379,
+    4390, 4401, 4406, 4419, 4432, 4443, 4450, 4458, 4467, 4474, 4481, 4487,
+    4498, 4510, 4515, 4519, 4526, 4534, 4541, 4548, 4557, 4565, 4574, 4586,
+    4596, 4600, 4610, 4614, 4619, 4627, 4631, 4637, 4645, 4650, 4653, 4658,
+    4665, 4675, 4682, 4690, 4698, 4705, 4710, 4715, 4721, 4729, 4735, 4744,
+    4749, 4755, 4759, 4767, 4777, 4787, 4796, 4807, 4811, 4818, 4825, 4834,
+    4847, 4855, 4864, 4867, 4874, 4879, 4886, 4891, 4899, 4910, 4917, 4924,
+    4933, 4944, 4958, 4966, 4974, 4981, 4990, 5001, 5003, 5007, 5012, 5016,
+    5027, 5035, 5042, 5051, 5062, 5068, 5081, 5087, 5097, 5101, 5108, 5116,
+    5124, 5133, 5143, 5148, 5155, 5163, 5166, 5174, 5183, 5193, 5199, 5205,
+    5214, 5223, 5229, 5233, 5241, 5251, 5255, 5260, 5268, 5277, 5286, 5289,
+    5294, 5297, 5303, 5311, 5317, 5321, 5326, 5333, 5339, 5346, 5353, 5359,
+    5367, 5381, 5392, 5397, 5410, 5419, 5431, 5440, 5451, 5461, 5473, 5482,
+    5491, 5499, 5504, 5510, 5513, 5519, 5524, 5529, 5535, 5541, 5547, 5553,
+    5559, 5563, 5570, 5577, 5582, 5587, 5592, 5597, 5601, 5606, 5611, 5622,
+    5627, 5641, 5646, 5653, 5661, 5669, 5677, 5685, 5689, 5694, 5701, 5708,
+    5712, 5719, 5726, 5730, 5735, 5739, 5746, 5750, 5760, 5769, 5773, 5781,
+    5788, 5794, 5803, 5811, 5817, 5823, 5831, 5836, 5840, 5845, 5852, 5862,
+    5871, 5883, 5888, 5897, 5902, 5909, 5913, 5921, 5930, 5934, 5939, 5946,
+    5949, 5960, 5970, 5979, 5984, 5995, 6002, 6008, 6016, 6022, 6029, 6035,
+    6041, 6045, 6049, 6059, 6065, 6073, 6081, 6092, 6098, 6106, 6115, 6123,
+    6130, 6137, 6145, 6154, 6162, 6172, 6178, 6186, 6198, 6203, 6213, 6220,
+    6228, 6235, 6241, 6249, 6257, 6267, 6275, 6285, 6293, 6302, 6311, 6318,
+    6326, 6332, 6341, 6347, 6356, 6365, 6373, 6380, 6388, 6395, 6401, 6410,
+    6417, 6425, 6431, 6438, 6445, 6452, 6456, 6464, 6471, 6477, 6487, 6496,
+    6503, 6511, 6517, 6520, 6524, 6531, 6539, 6544, 6553, 6560, 6566, 6571,
+    6577, 6585, 6589, 6595, 6604, 6609, 6615, 6621, 6626, 6630, 6634, 6640,
+    6647, 6657, 6672, 6678, 6683, 6690, 6694, 6706, 6716, 6723, 6728, 6738,
+    6747, 6750, 6761, 6771, 6778, 6791, 6807, 6814, 6820, 6833, 6839, 6849,
+    6856, 6867, 6876, 6881, 6887, 6894, 6901, 6905, 6909, 6914, 6919, 6923,
+    6927, 6936, 6943, 6947, 6951, 6955, 6961, 6968, 6972, 6978, 6985, 7001,
+    7005
+};
+
+static const char HMS_DB_WORDS[] =
+    "theThefilamentbeismayorhastopleasePleaseandmotorainrunAMS1AMS2AMS3AMS4checksensorfilament.Slot1S"
+    "lot2Slot3Slot4ofstuck.toobrokennewontangledoldfaulty.temperaturecannothaveifout.overloaded.stuck"
+    "insertancurrentmalfunctioning.notFailedRFID-tagextruderRFIDcontrolerror.extrusiontoolslipped.spo"
+    "olthin.torquewheelspeedabnormal.purgingempty;head.abnormally;clickfilament;identified.malfunctio"
+    "ning,out,slotwentfailed.heatbednozzleprintFilamentAMSbecausechamberheaterloadwithoutwhethercircu"
+    "it.\"Retry\"hardwarePTFEforbutton.cloggederror:fromjob.printerseetoolhead.whileyourforcereadbyextr"
+    "udelengthodometryrestarttrywasAMS.Chamberabnormal;damaged.itout;sameAfterassistcircuitit'swaitIf"
+    "Microautomaticallycontentstructuraltroubleshooting,tube.wait.1PurgingRFarecausingcoildamageddete"
+    "ctedpurged.slip.slot1slot2slot3slot4switchedthin,2beenbroken.canopenplatepullItYouaxiscleanconne"
+    "ctionyouagain.betweenboardextruder.shortthisMicroSDThisbuildcausedconnection.failurenetworkprint"
+    "ingroutersignalLidarPrintingatdefectsfilelayersystemcameradetected.endfailedresumetemperature.ac"
+    "cessbindingcoredump,device.frontheatinghomingrecovering.seems\"Resume\"&3SDbeforecutterduefanfeedi"
+    "ntolaserreplacestillCardCloudThereZabnormal,buttoncardcommunicationdeviceinspectionlow.messagepl"
+    "uggedpowerthereweak.AFirstHeatbedPossiblePrintYouranybackbeltchipclogged.closerconnectorcontactd"
+    "own,firstformatheater'sinsidemovingprinter.settingsstopped.timingwhichAnQRXYabnormal:bedcalibrat"
+    "ioncodeconfigurationcovereddatadoorenoughfrequencyholdermoduleoverpersists,positionprint.printin"
+    "g.resendresistanceresonanceshouldstuck,tapthentoolheadwastewerewhenworn4AssistantMotor-AMotor-BM"
+    "otor-EMotor-ZReferSlot1'sSlot2'sSlot3'sSlot4'sairanalogbeingcablecable.causechute.connectcontinu"
+    "ouscoolingcoulddirty.disabled.discoverydisturbanceencryptionexternalextrudingfactoryforce.gethan"
+    "dleholder.in.instabilityit.jobjobslocationloose,loose.machinemakemightmovemultiplenozzle.objects"
+    "occurred.open-circuit.outsideproperlyproperly.qualityreferregionsamplingscreenshort-circuit.supp"
+    "lysupportedsurethermaltubeunexpectedupupdatinguseACAPPDeviceExternalForceHMS.NozzlePurgedSpaghet"
+    "tiUnableacceptable,accountadjustadjustingafterallowedarmasavailablebuffercan'tcarboncard.connect"
+    "ed.continue.covercustomerdecideelectricelectronicentangledexceedsexception.failed;failing,fallen"
+    "filament,file.forwardheadheatbed.high.horizontalhotinaccurate.internet,issueloginlonglow,malfunc"
+    "tion.malfunctioning;mappingmarkermodelnormally.open.parameterspausedpiledpoorprintedprocessranre"
+    "pairrodscrewsensitive.sentservice.slicedslowsolutions.somethingspacespace.spool.storagestrainsup"
+    "port,tight.timedtimestouchedtriedunloadvalueverticalwillwirewithout(Connect.AIAMS)APBambuBinding"
+    "ForeignIPInInternalLidar.MCMonitoring.SomeStoppedSystemTimelapseTimeoutUSBXYY-axisaboutaboveacce"
+    "lerationaccordingactualafterward.allappearsautomaticavailable,binding.brightcalibratecalibration"
+    ".cancelchangecheckingclipclog.confirmconsistentcontinuecontinuingcontrollercorrectly.cutter'scut"
+    "tingdetectiondiffersdisabled;distancedownloaddriverduringeddyeffect.enableenvironmentextruded,fa"
+    "iled,fellfilament'sfilaments,firewallflat,foreignfound.freefullfusegreatlyhanghead;heatheighthol"
+    "der,hotbed.inabilityincludeinformationinformation.inletinstalledinstalled.interferenceinterferen"
+    "ce,interference.issue.keeplarge.lastleadlenslens.limitlinelit.loadedlocalizationlosematerial.mat"
+    "termediamodel.muchnormal.not,offoff.operationsorderotheroutletpagepanicposition.printer;progress"
+    ",protectpushputreasonsrecoveredreinsert.rejected.relatedreleaserepeatedly.rerunresistance.restar"
+    "t.restrictions.retryrisesecurityselectsendsensitivityservicesettings.signsslicingslidersslightly"
+    "slow.sospaghettistatus,steps.stoppedswitchtable;targettask,tear.temperature,thattime.transmissio"
+    "ntubesturnuser.videovitrificationwaitingwearwide.wireless\"By\"Done\"\"Done\";\"Resume\".\"Retry\".\"Retry"
+    ".\"\"retry\",1.1010\302\260C.2.3.AHBAMS1.AMS2.AMS3.AMS4.APP/StudioAbnormalAlreadyAuthorizationAutoBedBuil"
+    "dCFCTCCalibrationCard.Card:Card;CheckCheckingClickCloud.Continue?CuttingDHCPDataDetectedEnabling"
+    "EncryptionExtrudingFAT32.G-code.GcodeHandyHardwareHighHomingHubInspectingItsLEDLevelingLiveviewM"
+    "CUMOSFETMechanicalNoNotOTPPCPartsRe-calibrateResendRestoringResumeRouterSkippingSlicingSpiralSta"
+    "rtingStreamingStudio/BambuSupport.SynchronizationTHTechnicalTemperatureTimeToToolheadTube.Unauth"
+    "orizedUnformattedUnsupportedWiFiWirelessabnormalabnormalityabnormally,abnormally.abortacceleerat"
+    "ionaccelerometeracceptable.addressaddress,addressesadheredadjustsaffectafter-salesafter-sales.ag"
+    "ainair.alignedaligned,alreadyambientappearingattachedattentionauto-recoveravailable.awaybbl_scre"
+    "enbindbladeblocked.blowbound.boundarybulgebutcachecamera.cancelled.canclipcapacitycarriagecelsiu"
+    "schartchutechute,circuit,clean.cleaning.clearclear.clogcloggingcollision.compatiblecomplete;conn"
+    "ection,coolcornerscorrectcorrectlycorrespondingcrooked.currentlycutcutter.cycledamage.data.defec"
+    "ts.degradationdegree.desireddetected,device_gatedevice_managerdiameterdisableddisplaydisplayeddi"
+    "ssipationdodoesdoor.downdownloadingdrifted.enabledenclosed,engineeringensureenvironmentalexceede"
+    "xhausted.exitexited.expired;exposureextrinsicextruding.fail.failingfailure.farfarther.filament:f"
+    "ilaments.files.finishfinishes.firmware.fixed.flatflowrateforegroundfourfull.functionfunction.fun"
+    "ctionsgasgoinggotgreat.heatbed,heatedhelphelp.homing.hotbedhotbed,hotbed:hotendhumidityidentific"
+    "ationidentified,imageincompatible:incorrectincorrectly.inserted.inspection;installed,insufficien"
+    "tinternet.internet;invalid.ipcamissue;itsjammedjobs,keepslaser.layer,layer.layer:limit,linkloade"
+    "d,loaded.logs,logs.looseloss.lostlost:lowermaintenancemakermalfunctioningmatchmatchedmaterialmat"
+    "ters.meteringmissing;modemode.modulesmoment.moremoving,moving.namename.needneeded?nextnon-toxic."
+    "normally;now.object\".observeobtainoccluded,occurredoccursoff/onoffline.okay.one.open,openingoper"
+    "ation.otherwiseoverheating.page.parameterparseparsingpartpasswordpassword.pathpath.paused.payper"
+    "formanceperformed.persists.phonephotographypile-uppileuppipelineplacedplaced.plate,plate.poolpor"
+    "tpositionedpower.presets.previouspreviously.print,printed.printer'sprinter,prints.problemproblem"
+    ".problems.progressprotectionpushedradiatorre-calibratereachread/writereason.rebootedreceiverecor"
+    "drecorderrecords.reflectionregisterreinitiatereinsertreinsert,released.remountremoved.renamerepl"
+    "aced.reportrequests.required.residualrespondresponserestoreresultresultingresultsresumingretry.r"
+    "outer,router.runningscanscanningscreen.sectorself-checkself-testsensor.sequenceserialsetset.sett"
+    "ingsetting.shiftshooting.skippedslicerslot.slots,softwaresomespringstainlessstatestate.state;ste"
+    "elstepstopstuck;supportsupported.synchronizationtable.takentangle.tasktemporarily.terminatedtilt"
+    "ed.time,time-lapsetimelapsetiptraditionaltriggeringtroubletroubleshoot.troubleshooting.turningun"
+    "ableunauthorized.unbindunfinishedunknownunreadable.unstable;untilupdateupdatedupgradeuse.useduse"
+    "r:usingvaseventvibrationvoltagewantweakwellwheelswheels.wikiworkedworkingwrite-protected.xcam";
+
+#endif /* HMS_DATABASE_DATA_H_ */
@@ -0,0 +1,281 @@
+#include "JsonStreamFilter.h"
+#include <string.h>
+
+void JsonStreamFilter::begin(JsonVariantConst filter, char *output, size_t size) {
+  root = filter;
+  this->output = output;
+  this->size = size;
+  if (size > 0) {
+    output[0] = 0;
+  }
+  depth = 0;
+  expectKey = false;
+  inString = false;
+  inKey = false;
+  inScalar = false;
+  escape = false;
+  tokenAction = skip;
+  keyLength = 0;
+  keyTooLong = false;
+  length = 0;
+  kept = 0;
+  complete = false;
+  error = none;
+}
+
+const char* JsonStreamFilter::getError() const {
+  switch (error) {
+    case tooDeep: return "nested too deeply";
+    case tooLong: return "filtered output too long";
+    case badSyntax: return "invalid JSON";
+    default: return complete ? "none" : "incomplete";
+  }
+}
+
+void JsonStreamFilter::feed(const char *data, size_t length) {
+  for (size_t i=0; i < length && error == none; i++) {
+    if (inString && tokenAction == skip && !escape) {
+      i += skipString(data + i, length - i);
+      if (i == length) {
+        break;
+      }
+    }
+    process(data[i]);
+  }
+
+  if (this->length > maxLength) {
+    maxLength = this->length;
+  }
+}
+
+void JsonStreamFilter::emit(char c) {
+  if (length + 1 < size) {
+    output[length++] = c;
+    output[length] = 0;
+  } else {
+    error = tooLong;
+  }
+}
+
+void JsonStreamFilter::emit(const char *s, size_t n) {
+  for (size_t i=0; i < n; i++) {
+    emit(s[i]);
+  }
+}
+
+// Most of a report is strings nobody wants. Only a quote or a backslash can change anything inside
+// one, so jump straight to the next of those, which memchr() can look for a word at a time rather than a
+// byte. Returns how many bytes can be passed over.
+size_t JsonStreamFilter::skipString(const char *data, size_t length) {
+  const char *quote = (const char *)memchr(data, '"', length);
+  size_t end = quote ? quote - data : length;
+  const char *backslash = (const char *)memchr(data, '\\', end);
+  return backslash ? backslash - data : end;
+}
+
+static inline bool isWhitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static inline bool isDelimiter(char c) {
+  return isWhitespace(c) || c == ',' || c == '}' || c == ']' || c == ':';
+}
+
+void JsonStreamFilter::process(char c) {
+  if (inString) {
+    if (inKey && !escape && c == '"') {
+      inString = false;
+      endKey();
+      return;
+    }
+
+    if (inKey) {
+      if (tokenAction == copy) {
+        emit(c);
+      } else if (keyLength < MAX_KEY) {
+        key[keyLength++] = c;
+      } else {
+        keyTooLong = true;
+      }
+    } else if (tokenAction == copy) {
+      emit(c);
+    }
+
+    if (escape) {
+      escape = false;
+    } else if (c == '\\') {
+      escape = true;
+    } else if (c == '"') {
+      inString = false;
+      endValue();
+    }
+    return;
+  }
+
+  if (inScalar) {
+    if (!isDelimiter(c)) {
+      if (tokenAction == copy) {
+        emit(c);
+      }
+      return;
+    }
+    inScalar = false;
+    endValue();
+  }
+
+  if (isWhitespace(c)) {
+    return;
+  }
+
+  Level *level = depth > 0 ? &levels[depth - 1] : 0;
+
+  switch (c) {
+    case '"':
+      inString = true;
+      if (expectKey) {
+        inKey = true;
+        keyLength = 0;
+        keyTooLong = false;
+        tokenAction = level->action;
+        if (tokenAction == copy) {
+          emit(c);
+        }
+      } else {
+        tokenAction = startValue(c);
+      }
+      break;
+
+    case '{':
+    case '[':
+      {
+        if (depth >= MAX_DEPTH) {
+          error = tooDeep;
+          return;
+        }
+
+        JsonVariantConst filter = depth == 0 ? root : levels[depth - 1].isObject ? keyFilter : levels[depth - 1].filter;
+        Action action = startValue(c);
+        Level& child = levels[depth++];
+        // An array's filter is the filter for each of its elements
+        child.filter = c == '[' ? filter[0] : filter;
+        child.action = action;
+        child.isObject = c == '{';
+        child.empty = true;
+        expectKey = child.isObject;
+      }
+      break;
+
+    case '}':
+    case ']':
+      if (!level || level->isObject != (c == '}')) {
+        error = badSyntax;
+        return;
+      }
+      if (level->action != skip) {
+        emit(c);
+      }
+      depth--;
+      expectKey = false;
+      endValue();
+      break;
+
+    case ':':
+      if (!level || !level->isObject) {
+        error = badSyntax;
+        return;
+      }
+      if (level->action == copy) {
+        emit(c);
+      }
+      expectKey = false;
+      break;
+
+    case ',':
+      if (!level) {
+        error = badSyntax;
+        return;
+      }
+      if (level->action == copy) {
+        emit(c);
+      }
+      expectKey = level->isObject;
+      break;
+
+    default:
+      inScalar = true;
+      tokenAction = startValue(c);
+      if (tokenAction == copy) {
+        emit(c);
+      }
+      break;
+  }
+}
+
+void JsonStreamFilter::endKey() {
+  inKey = false;
+
+  Level& level = levels[depth - 1];
+  if (level.action == copy) {
+    emit('"');
+  } else if (level.action == navigate) {
+    key[keyLength] = 0;
+    keyFilter = keyTooLong ? JsonVariantConst() : level.filter[(const char*)key];
+  }
+}
+
+// Works out what to do with a value that starts with c, and writes whatever has to come before it
+JsonStreamFilter::Action JsonStreamFilter::startValue(char c) {
+  if (depth == 0) {
+    // The filter itself is the top level object
+    if (c == '{' && root.is<JsonObjectConst>()) {
+      emit(c);
+      return navigate;
+    }
+    return skip;
+  }
+
+  Level& parent = levels[depth - 1];
+  if (parent.action != navigate) {
+    // Anything under a value being kept or skipped goes the same way
+    if (parent.action == copy && (c == '{' || c == '[' || c == '"')) {
+      emit(c);
+    }
+    return parent.action;
+  }
+
+  // Object members are picked by their key, array elements all share the one filter
+  JsonVariantConst filter = parent.isObject ? keyFilter : parent.filter;
+  Action action = skip;
+  if (filter.is<bool>() && filter.as<bool>()) {
+    action = copy;
+    kept++;
+  } else if (c == '{' && filter.is<JsonObjectConst>()) {
+    action = navigate;
+  } else if (c == '[' && filter.is<JsonArrayConst>()) {
+    action = navigate;
+  }
+
+  if (action != skip) {
+    if (!parent.empty) {
+      emit(',');
+    }
+    parent.empty = false;
+    if (parent.isObject) {
+      emit('"');
+      emit(key, keyLength);
+      emit('"');
+      emit(':');
+    }
+    if (c == '{' || c == '[' || c == '"') {
+      emit(c);
+    }
+  }
+
+  return action;
+}
+
+void JsonStreamFilter::endValue() {
+  if (depth == 0) {
+    complete = true;
+  }
+}
@@ -0,0 +1,85 @@
+#ifndef JSONSTREAMFILTER_H
+#define JSONSTREAMFILTER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <ArduinoJson.h>
+
+/*
+ * Filters a JSON document a fragment at a time, keeping only the parts
+ * selected by an ArduinoJson style filter (an object whose members are
+ * either true, to keep the whole value, or another filter object). What
+ * is kept is written out as compact JSON, so a report of any size can be
+ * cut down to a few hundred bytes as it arrives and then handed to
+ * deserializeJson() as usual.
+ *
+ * As with ArduinoJson, a filter array holds one filter that is applied
+ * to every element of the array.
+ */
+class JsonStreamFilter {
+public:
+  static const uint8_t MAX_DEPTH = 32;
+  static const uint8_t MAX_KEY = 32;
+
+  // Starts a new document, which is filtered into output, NUL terminated
+  void begin(JsonVariantConst filter, char *output, size_t size);
+  void feed(const char *data, size_t length);
+
+  // True once the top level value has been closed, without any errors on the way
+  bool isComplete() const { return complete && !error; }
+  // Why it isn't complete, for logging
+  const char* getError() const;
+
+  const char* getOutput() const { return output; }
+  size_t getLength() const { return length; }
+  // How many values the filter picked out. None means there is nothing worth parsing
+  uint16_t getKept() const { return kept; }
+
+  // The most that has been kept from one document
+  size_t getMaxLength() const { return maxLength; }
+
+private:
+  enum Action : uint8_t { skip, copy, navigate };
+  enum Error : uint8_t { none, tooDeep, tooLong, badSyntax };
+
+  struct Level {
+    JsonVariantConst filter;  // For arrays, the filter for each element
+    Action action;
+    bool isObject;
+    bool empty;     // Nothing written inside it yet
+  };
+
+  JsonVariantConst root;
+  Level levels[MAX_DEPTH];
+  uint8_t depth = 0;
+
+  bool expectKey = false;
+  bool inString = false;
+  bool inKey = false;
+  bool inScalar = false;
+  bool escape = false;
+  Action tokenAction = skip;   // What is being done with the current string or scalar
+
+  char key[MAX_KEY + 1];
+  uint8_t keyLength = 0;
+  bool keyTooLong = false;
+  JsonVariantConst keyFilter;  // Filter for the value of the last key seen in a navigated object
+
+  char *output = 0;
+  size_t size = 0;
+  size_t length = 0;
+  size_t maxLength = 0;
+  uint16_t kept = 0;
+  bool complete = false;
+  Error error = none;
+
+  void process(char c);
+  size_t skipString(const char *data, size_t length);
+  Action startValue(char c);
+  void endKey();
+  void endValue();
+  void emit(char c);
+  void emit(const char *s, size_t n);
+};
+
+#endif // JSONSTREAMFILTER_H
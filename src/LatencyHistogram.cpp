@@ -0,0 +1,91 @@
+#include "LatencyHistogram.h"
+
+void LatencyHistogram::reset() {
+  memset(buckets, 0, sizeof(buckets));
+  count = 0;
+  minMicros = UINT32_MAX;
+  maxMicros = 0;
+  sum = 0;
+}
+
+uint8_t LatencyHistogram::getBucket(uint32_t micros) {
+  if (micros < 4) {
+    return micros;
+  }
+
+  // The top bit picks the power of two, the two below it pick the quarter
+  uint8_t msb = 31 - __builtin_clz(micros);
+  uint16_t bucket = (msb - 1) * 4 + ((micros >> (msb - 2)) & 3);
+
+  return bucket < NUM_BUCKETS ? bucket : NUM_BUCKETS - 1;
+}
+
+uint32_t LatencyHistogram::getBucketStart(uint8_t bucket) {
+  if (bucket < 4) {
+    return bucket;
+  }
+
+  uint8_t msb = bucket / 4 + 1;
+  return (uint32_t)(4 + bucket % 4) << (msb - 2);
+}
+
+void LatencyHistogram::add(uint32_t micros) {
+  buckets[getBucket(micros)]++;
+  count++;
+  sum += micros;
+  if (micros < minMicros) {
+    minMicros = micros;
+  }
+  if (micros > maxMicros) {
+    maxMicros = micros;
+  }
+}
+
+uint32_t LatencyHistogram::getPercentile(uint16_t permille) const {
+  if (count == 0) {
+    return 0;
+  }
+
+  uint32_t rank = ((uint64_t)count * permille + 999) / 1000;
+  uint32_t seen = 0;
+
+  for (uint8_t i=0; i < NUM_BUCKETS; i++) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      // Report the top of the bucket, but never more than was actually seen
+      uint32_t top = i + 1 < NUM_BUCKETS ? getBucketStart(i + 1) - 1 : maxMicros;
+      return top < maxMicros ? top : maxMicros;
+    }
+  }
+
+  return maxMicros;
+}
+
+String LatencyHistogram::toString() const {
+  return String(getMin()) + "/" + String(getAverage()) + "/" + String(getMax()) + "/" + String(getPercentile(990)) + "us";
+}
+
+String LatencyHistogram::toJson() const {
+  String json = "{\"n\":" + String(count)
+    + ",\"min\":" + String(getMin())
+    + ",\"avg\":" + String(getAverage())
+    + ",\"max\":" + String(getMax())
+    + ",\"p99\":" + String(getPercentile(990))
+    + ",\"b\":[";
+
+  int last = NUM_BUCKETS - 1;
+  while (last >= 0 && buckets[last] == 0) {
+    last--;
+  }
+
+  for (int i=0; i <= last; i++) {
+    if (i > 0) {
+      json += ',';
+    }
+    json += String(buckets[i]);
+  }
+
+  json += "]}";
+
+  return json;
+}
@@ -0,0 +1,50 @@
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <stdint.h>
+#include <Arduino.h>
+
+/*
+ * Log-linear histogram of microsecond timings: four buckets per power of
+ * two, so any value is placed within 25%, from 1us up to ~30s. Adding a
+ * sample is a few instructions, all of the summarizing is done when
+ * someone asks for it.
+ *
+ * Samples are added from one task and read from another without locking,
+ * so a summary may be off by the sample that was being added at the time.
+ */
+class LatencyHistogram {
+public:
+  static const uint8_t NUM_BUCKETS = 96;
+
+  LatencyHistogram() { reset(); }
+
+  void add(uint32_t micros);
+  void reset();
+
+  uint32_t getCount() const { return count; }
+  uint32_t getMin() const { return count ? minMicros : 0; }
+  uint32_t getMax() const { return maxMicros; }
+  uint32_t getAverage() const { return count ? sum / count : 0; }
+
+  // The value that permille thousandths of the samples are at or below, to bucket accuracy
+  uint32_t getPercentile(uint16_t permille) const;
+
+  // "min/avg/max/p99" in us
+  String toString() const;
+
+  // {"n":..,"min":..,"avg":..,"max":..,"p99":..,"b":[...]} with trailing empty buckets left off
+  String toJson() const;
+
+  static uint8_t getBucket(uint32_t micros);
+  static uint32_t getBucketStart(uint8_t bucket);
+
+private:
+  uint32_t buckets[NUM_BUCKETS];
+  uint32_t count;
+  uint32_t minMicros;
+  uint32_t maxMicros;
+  uint64_t sum;
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,194 @@
+#include "LedOutput.h"
+
+LedOutput* LedOutput::create(uint8_t type) {
+  switch (type) {
+    case rgb:
+      return new LedOutputFor<NeoRgbFeature, NeoEsp32RmtNWs2812xMethod>();
+    case grbw:
+      return new LedOutputFor<NeoGrbwFeature, NeoEsp32RmtNSk6812Method>();
+    case rgbw:
+      return new LedOutputFor<NeoRgbwFeature, NeoEsp32RmtNSk6812Method>();
+    default:
+      return new LedOutputFor<NeoGrbFeature, NeoEsp32RmtNWs2812xMethod>();
+  }
+}
+
+uint8_t LedOutput::parsePins(const String& pinList, uint8_t defaultPin, uint8_t *pins) {
+  uint8_t numPins = 0;
+  int value = -1;
+
+  for (unsigned int i=0; i <= pinList.length(); i++) {
+    char c = i < pinList.length() ? pinList[i] : ',';
+    if (c >= '0' && c <= '9') {
+      value = (value < 0 ? 0 : value * 10) + (c - '0');
+    } else if (c == ',') {
+      if (value >= 0 && numPins < MAX_OUTPUTS) {
+        pins[numPins++] = value;
+      }
+      value = -1;
+    }
+  }
+
+  if (numPins == 0) {
+    pins[numPins++] = defaultPin;
+  }
+
+  return numPins;
+}
+
+bool LedOutput::isConfigured(uint16_t count, const uint8_t *pins, uint8_t numPins) const {
+  return count == this->count && hasPins(pins, numPins);
+}
+
+bool LedOutput::hasPins(const uint8_t *pins, uint8_t numPins) const {
+  if (numPins > MAX_OUTPUTS) {
+    numPins = MAX_OUTPUTS;
+  }
+
+  if (numPins != numOutputs) {
+    return false;
+  }
+
+  for (uint8_t i=0; i < numPins; i++) {
+    if (pins[i] != this->pins[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool LedOutput::configure(uint16_t count, uint16_t capacity, const uint8_t *pins, uint8_t numPins) {
+  if (count <= this->capacity && hasPins(pins, numPins)) {
+    // Fits in what is already allocated
+    blank();
+    setCount(count);
+    return false;
+  }
+
+  release();
+
+  if (numPins > MAX_OUTPUTS) {
+    numPins = MAX_OUTPUTS;
+  }
+
+  // Every bus is big enough for the longest run
+  uint16_t size = (max(count, capacity) + numPins - 1) / numPins;
+  this->capacity = size * numPins;
+
+  for (uint8_t i=0; i < numPins; i++) {
+    this->pins[i] = pins[i];
+    allocate(i, size, pins[i]);
+  }
+
+  numOutputs = numPins;
+  setCount(count);
+
+  return true;
+}
+
+void LedOutput::setCount(uint16_t count) {
+  this->count = count;
+  uint16_t perOutput = count / numOutputs;
+  uint16_t remainder = count % numOutputs;
+  uint16_t offset = 0;
+
+  for (uint8_t i=0; i < numOutputs; i++) {
+    // The first runs take one extra LED each if it doesn't divide evenly
+    lengths[i] = perOutput + (i < remainder ? 1 : 0);
+    offsets[i] = offset;
+    offset += lengths[i];
+  }
+}
+
+// Successive frames get thresholds spread as far apart as possible: 0, 128, 64, 192...
+static inline uint8_t reverseBits(uint8_t b) {
+  b = (b & 0xf0) >> 4 | (b & 0x0f) << 4;
+  b = (b & 0xcc) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xaa) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
+uint16_t LedOutput::limitPower(const FrameBuffer& frame) {
+  // Add up what the LEDs will actually be sent, i.e. after gamma
+  uint32_t sum = 0;
+  if (frame.isUniform()) {
+    sum = correction.sum(frame.getPixel(0)) * count;
+  } else {
+    for (uint16_t index=0; index < count; index++) {
+      sum += correction.sum(frame.getPixel(index));
+    }
+  }
+
+  uint32_t idleMilliamps = count * IDLE_MA_PER_LED;
+  uint32_t channelMilliamps = (sum >> 8) * MA_PER_CHANNEL / 255;
+  uint16_t scale = 256;
+
+  if (maxMilliamps > 0 && idleMilliamps + channelMilliamps > maxMilliamps) {
+    // The idle draw can't be scaled away, only what the channels take
+    scale = maxMilliamps > idleMilliamps ? (maxMilliamps - idleMilliamps) * 256 / channelMilliamps : 0;
+  }
+
+  estimatedMilliamps = idleMilliamps + channelMilliamps * scale / 256;
+
+  return scale;
+}
+
+bool LedOutput::write(const FrameBuffer& frame) {
+  bool written = false;
+  bool anyFractional = false;
+  uint16_t start = frame.getDirtyStart();
+  uint16_t end = min(frame.getDirtyEnd(), count);
+  uint8_t frameThreshold = reverseBits(ditherFrame++);
+
+  uint16_t scale = count > 0 ? limitPower(frame) : 256;
+  if (scale != this->scale) {
+    // Everything has to be rescaled, not just what changed
+    this->scale = scale;
+    start = 0;
+    end = count;
+  }
+
+  for (uint8_t i=0; i < numOutputs; i++) {
+    uint16_t from = max(start, offsets[i]);
+    uint16_t to = min(end, (uint16_t)(offsets[i] + lengths[i]));
+    if (from >= to) {
+      continue;
+    }
+
+    anyFractional |= writeOutput(i, frame, from, to, frameThreshold);
+    written = true;
+  }
+
+  fractional = anyFractional;
+
+  return written;
+}
+
+uint16_t LedOutput::getLongestOutput() const {
+  uint16_t longest = 0;
+  for (uint8_t i=0; i < numOutputs; i++) {
+    if (getBusSize(i) > longest) {
+      longest = getBusSize(i);
+    }
+  }
+  return longest;
+}
+
+uint16_t LedOutput::getLongestRun() const {
+  uint16_t longest = 0;
+  for (uint8_t i=0; i < numOutputs; i++) {
+    if (lengths[i] > longest) {
+      longest = lengths[i];
+    }
+  }
+  return longest;
+}
+
+uint32_t LedOutput::getExpectedFrameMicros() const {
+  return getLongestOutput() * getPixelSize() * MICROS_PER_BYTE + LATCH_MICROS;
+}
+
+uint32_t LedOutput::getLiveFrameMicros() const {
+  return getLongestRun() * getPixelSize() * MICROS_PER_BYTE + LATCH_MICROS;
+}
@@ -0,0 +1,246 @@
+#ifndef LEDOUTPUT_H
+#define LEDOUTPUT_H
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <NeoPixelBus.h>
+#include "FrameBuffer.h"
+#include "ColorCorrection.h"
+
+/*
+ * Drives the strip from one or more pins. The LEDs are split into equal
+ * contiguous runs, one per pin (the first runs get one more LED if the
+ * count doesn't divide evenly), and each pin gets its own RMT channel. RMT
+ * sends in the background, so all of the runs are clocked out at the same
+ * time and a frame only takes as long as the longest run.
+ *
+ * The buses are sized for a capacity rather than the LED count, so the count
+ * can change without freeing and reallocating their buffers. Any pixels past
+ * the end of a run are left black. NeoPixelBus always clocks out a bus's
+ * whole buffer though, so those black pixels cost as much time per frame as
+ * lit ones: 36 LEDs with room for 1000 take as long to show as 1000 do.
+ * That is why nothing is reserved beyond the count unless max_leds asks.
+ *
+ * This holds everything that doesn't depend on the strip type: the layout,
+ * color correction, dithering and power limiting.
+ */
+class LedOutput {
+public:
+  // Values of led_type
+  enum Type { grb, rgb, grbw, rgbw, num_types };
+
+#if defined(CONFIG_IDF_TARGET_ESP32C3)
+  static const uint8_t MAX_OUTPUTS = 2;
+#elif defined(CONFIG_IDF_TARGET_ESP32S3)
+  static const uint8_t MAX_OUTPUTS = 4;
+#else
+  static const uint8_t MAX_OUTPUTS = 8;
+#endif
+
+  // 8 bits at 800kbps, plus the latch time after each frame
+  static const uint32_t MICROS_PER_BYTE = 10;
+  static const uint32_t LATCH_MICROS = 300;
+
+  // Rough WS2812 draw: each channel at full, plus what an LED takes when it is dark
+  static const uint32_t MA_PER_CHANNEL = 20;
+  static const uint32_t IDLE_MA_PER_LED = 1;
+
+  static const uint8_t ROUND_TO_NEAREST = 128;
+  static const uint8_t DITHER_STRIDE = 159;  // ~256/phi
+
+  // Makes the output for a strip type. Falls back to GRB for anything unknown.
+  static LedOutput* create(uint8_t type);
+
+  LedOutput() : numOutputs(0), count(0), capacity(0), ditherEnabled(false), moving(false), dithering(false), fractional(false), ditherFrame(0),
+    maxMilliamps(0), scale(256), estimatedMilliamps(0) {}
+  virtual ~LedOutput() {}
+
+  // Returns the number of pins found in a comma separated list, or the default pin if there are none
+  static uint8_t parsePins(const String& pinList, uint8_t defaultPin, uint8_t *pins);
+
+  // Returns true if the buses had to be (re)allocated, in which case begin() must be called
+  bool configure(uint16_t count, uint16_t capacity, const uint8_t *pins, uint8_t numPins);
+  bool isConfigured(uint16_t count, const uint8_t *pins, uint8_t numPins) const;
+  virtual void begin() = 0;
+  virtual void clear() = 0;
+
+  void setCorrection(uint8_t gamma, uint8_t red, uint8_t green, uint8_t blue) { correction.build(gamma, red, green, blue); }
+  void setDithering(bool enabled) { ditherEnabled = enabled; dithering = enabled && moving; }
+  // Frames are only dithered while the picture is changing. A still one is rounded to nearest
+  // and then left alone, rather than being redrawn every frame for ever.
+  void setMoving(bool moving) { this->moving = moving; dithering = ditherEnabled && moving; }
+
+  // Output is scaled down whenever the estimated draw would go over this. 0 = no limit.
+  void setMaxMilliamps(uint32_t maxMilliamps) { this->maxMilliamps = maxMilliamps; }
+  uint32_t getEstimatedMilliamps() const { return estimatedMilliamps; }
+  uint16_t getPowerScale() const { return scale; }
+
+  // True if the last frame written was dithered, in which case it has to be written and shown
+  // again, all of it, even if it hasn't changed: to carry on dithering it, or to round it to
+  // nearest once it has stopped moving
+  bool isDithering() const { return fractional; }
+
+  // Corrects the dirty part of the frame into the strip buffers. Returns true if anything changed.
+  bool write(const FrameBuffer& frame);
+  virtual void show() = 0;
+
+  uint16_t getCount() const { return count; }
+  uint16_t getCapacity() const { return capacity; }
+  uint8_t getNumOutputs() const { return numOutputs; }
+  uint16_t getLongestOutput() const;
+  uint16_t getLongestRun() const;
+
+  // What the timing model says one Show() of the whole strip costs, black padding included
+  uint32_t getExpectedFrameMicros() const;
+  // The same for only the LEDs in use, i.e. what it would cost with nothing reserved
+  uint32_t getLiveFrameMicros() const;
+
+protected:
+  uint8_t pins[MAX_OUTPUTS];
+  uint16_t offsets[MAX_OUTPUTS];
+  uint16_t lengths[MAX_OUTPUTS];
+  uint8_t numOutputs;
+  uint16_t count;
+  uint16_t capacity;
+
+  ColorCorrection correction;
+  bool ditherEnabled;
+  bool moving;
+  bool dithering;   // Enabled and moving
+  bool fractional;
+  uint8_t ditherFrame;
+
+  uint32_t maxMilliamps;
+  uint16_t scale;
+  uint32_t estimatedMilliamps;
+
+  // The parts that depend on the bus type
+  virtual void allocate(uint8_t output, uint16_t size, uint8_t pin) = 0;
+  virtual void release() = 0;
+  virtual void blank() = 0;
+  virtual uint16_t getBusSize(uint8_t output) const = 0;
+  virtual size_t getPixelSize() const = 0;
+
+  // Writes frame pixels [from, to) to one output. Returns true if any of them are being dithered.
+  virtual bool writeOutput(uint8_t output, const FrameBuffer& frame, uint16_t from, uint16_t to, uint8_t frameThreshold) = 0;
+
+private:
+  bool hasPins(const uint8_t *pins, uint8_t numPins) const;
+  void setCount(uint16_t count);
+  uint16_t limitPower(const FrameBuffer& frame);
+};
+
+/*
+ * The per-pixel work, compiled separately for each strip type so the
+ * color order and pixel size are fixed at compile time and the inner
+ * loops don't have to check them.
+ */
+template <class T_FEATURE, class T_METHOD>
+class LedOutputFor : public LedOutput {
+public:
+  typedef NeoPixelBus <T_FEATURE, T_METHOD> PixelBus;
+  typedef typename T_FEATURE::ColorObject ColorObject;
+
+  virtual ~LedOutputFor() { release(); }
+
+  virtual void begin() {
+    for (uint8_t i=0; i < numOutputs; i++) {
+      buses[i]->Begin(); // This initializes the NeoPixel library.
+      buses[i]->Show();
+    }
+  }
+
+  virtual void clear() {
+    for (uint8_t i=0; i < numOutputs; i++) {
+      buses[i]->ClearTo(0);
+      buses[i]->Show();
+      buses[i]->Dirty();
+      buses[i]->Show();
+    }
+  }
+
+  virtual void show() {
+    // Each Show() just starts its RMT channel, so the pins are sent in parallel
+    for (uint8_t i=0; i < numOutputs; i++) {
+      buses[i]->Show();
+    }
+  }
+
+protected:
+  virtual void allocate(uint8_t output, uint16_t size, uint8_t pin) {
+    buses[output] = new PixelBus(size, pin, (NeoBusChannel)output);
+  }
+
+  virtual void release() {
+    for (uint8_t i=0; i < numOutputs; i++) {
+      delete buses[i];
+    }
+    numOutputs = 0;
+  }
+
+  virtual void blank() {
+    for (uint8_t i=0; i < numOutputs; i++) {
+      buses[i]->ClearTo(0);
+    }
+  }
+
+  virtual uint16_t getBusSize(uint8_t output) const { return buses[output]->PixelCount(); }
+  virtual size_t getPixelSize() const { return T_FEATURE::PixelSize; }
+
+  virtual bool writeOutput(uint8_t output, const FrameBuffer& frame, uint16_t from, uint16_t to, uint8_t frameThreshold) {
+    bool anyFractional = false;
+    uint16_t busStart = offsets[output];
+
+    // Write straight into the bus's wire-order buffer rather than going through SetPixelColor()
+    uint8_t *data = buses[output]->Pixels();
+    const RgbColor& first = frame.getPixel(from);
+    if (frame.isUniform() && !(dithering && correction.isFractional(first, scale))) {
+      // Encode the color once, then keep doubling the copied run until the range is covered
+      const size_t pixelSize = T_FEATURE::PixelSize;
+      T_FEATURE::applyPixelColor(data, from - busStart, toColorObject(correction.apply(first, ROUND_TO_NEAREST, scale)));
+
+      uint8_t *run = data + (from - busStart) * pixelSize;
+      size_t total = (to - from) * pixelSize;
+      size_t copied = pixelSize;
+      while (copied < total) {
+        size_t chunk = min(copied, total - copied);
+        memcpy(run + copied, run, chunk);
+        copied += chunk;
+      }
+    } else if (dithering) {
+      for (uint16_t index=from; index < to; index++) {
+        // Neighbouring pixels get different thresholds too, so the strip doesn't flicker as a whole
+        uint8_t threshold = frameThreshold + index * DITHER_STRIDE;
+        const RgbColor& color = frame.getPixel(index);
+        anyFractional |= correction.isFractional(color, scale);
+        T_FEATURE::applyPixelColor(data, index - busStart, toColorObject(correction.apply(color, threshold, scale)));
+      }
+    } else {
+      for (uint16_t index=from; index < to; index++) {
+        T_FEATURE::applyPixelColor(data, index - busStart, toColorObject(correction.apply(frame.getPixel(index), ROUND_TO_NEAREST, scale)));
+      }
+    }
+    buses[output]->Dirty();
+
+    return anyFractional;
+  }
+
+private:
+  PixelBus *buses[MAX_OUTPUTS];
+
+  static inline ColorObject toColorObject(const RgbColor& color) {
+    return toColorObject(color, (ColorObject*)0);
+  }
+
+  static inline RgbColor toColorObject(const RgbColor& color, RgbColor*) {
+    return color;
+  }
+
+  // Whatever all three channels have in common goes on the white LED instead
+  static inline RgbwColor toColorObject(const RgbColor& color, RgbwColor*) {
+    uint8_t white = min(color.R, min(color.G, color.B));
+    return RgbwColor(color.R - white, color.G - white, color.B - white, white);
+  }
+};
+
+#endif // LEDOUTPUT_H
@@ -5,6 +5,7 @@
 #include <ConfigItem.h>
 
 #include "MQTTBroker.h"
+#include "HmsDatabase.h"
 
 extern AsyncWiFiManager wifiManager;
 
@@ -25,67 +26,96 @@ const char* CHAMBER_LIGHT_OFF = R"({"system": {"sequence_id": "0", "command": "l
         ],
 */
 
-//-1; 2; 14; 1; 8; 0
-std::map<int, std::string> MQTTBroker::CURRENT_STAGE_IDS = {
-    {0, "printing"},
-    {1, "auto_bed_leveling"},
-    {2, "heatbed_preheating"},
-    {3, "sweeping_xy_mech_mode"},
-    {4, "changing_filament"},
-    {5, "m400_pause"},
-    {6, "paused_filament_runout"},
-    {7, "heating_hotend"},
-    {8, "calibrating_extrusion"},
-    {9, "scanning_bed_surface"},
-    {10, "inspecting_first_layer"},
-    {11, "identifying_build_plate_type"},
-    {12, "calibrating_micro_lidar"},
-    {13, "homing_toolhead"},
-    {14, "cleaning_nozzle_tip"},
-    {15, "checking_extruder_temperature"},
-    {16, "paused_user"},
-    {17, "paused_front_cover_falling"},
-    {18, "calibrating_micro_lidar"},
-    {19, "calibrating_extrusion_flow"},
-    {20, "paused_nozzle_temperature_malfunction"},
-    {21, "paused_heat_bed_temperature_malfunction"},
-    {22, "filament_unloading"},
-    {23, "paused_skipped_step"},
-    {24, "filament_loading"},
-    {25, "calibrating_motor_noise"},
-    {26, "paused_ams_lost"},
-    {27, "paused_low_fan_speed_heat_break"},
-    {28, "paused_chamber_temperature_control_error"},
-    {29, "cooling_chamber"},
-    {30, "paused_user_gcode"},
-    {31, "motor_noise_showoff"},
-    {32, "paused_nozzle_filament_covered_detected"},
-    {33, "paused_cutter_error"},
-    {34, "paused_first_layer_error"},
-    {35, "paused_nozzle_clog"},
-    {-1, "idle"}, 
-    {255, "idle"}
+struct StageDescriptor {
+    int id;
+    uint8_t flags;
+    const char *name;
 };
 
 // What about spaghetti detected? Do we need to also check HMS (yes)
-std::set<int> MQTTBroker::ERROR_STAGES = {
-    6, 17, 20, 21, 26, 27, 28, 32, 33, 34, 35
+static const uint8_t STAGE_ERROR = 0x01;
+// The printer is using the camera, e.g. for lidar calibration or first layer inspection
+static const uint8_t STAGE_CAMERA_OFF = 0x02;
+static const uint8_t STAGE_IDLE = 0x04;
+
+// Indexed by stg_cur. 1 and 14 could also be camera off stages
+static constexpr StageDescriptor STAGES[] = {
+    {0, 0, "printing"},
+    {1, 0, "auto_bed_leveling"},
+    {2, 0, "heatbed_preheating"},
+    {3, 0, "sweeping_xy_mech_mode"},
+    {4, 0, "changing_filament"},
+    {5, 0, "m400_pause"},
+    {6, STAGE_ERROR, "paused_filament_runout"},
+    {7, 0, "heating_hotend"},
+    {8, STAGE_CAMERA_OFF, "calibrating_extrusion"},
+    {9, STAGE_CAMERA_OFF, "scanning_bed_surface"},
+    {10, STAGE_CAMERA_OFF, "inspecting_first_layer"},
+    {11, 0, "identifying_build_plate_type"},
+    {12, STAGE_CAMERA_OFF, "calibrating_micro_lidar"},
+    {13, 0, "homing_toolhead"},
+    {14, 0, "cleaning_nozzle_tip"},
+    {15, 0, "checking_extruder_temperature"},
+    {16, 0, "paused_user"},
+    {17, STAGE_ERROR, "paused_front_cover_falling"},
+    {18, STAGE_CAMERA_OFF, "calibrating_micro_lidar"},
+    {19, STAGE_CAMERA_OFF, "calibrating_extrusion_flow"},
+    {20, STAGE_ERROR, "paused_nozzle_temperature_malfunction"},
+    {21, STAGE_ERROR, "paused_heat_bed_temperature_malfunction"},
+    {22, 0, "filament_unloading"},
+    {23, 0, "paused_skipped_step"},
+    {24, 0, "filament_loading"},
+    {25, 0, "calibrating_motor_noise"},
+    {26, STAGE_ERROR, "paused_ams_lost"},
+    {27, STAGE_ERROR, "paused_low_fan_speed_heat_break"},
+    {28, STAGE_ERROR, "paused_chamber_temperature_control_error"},
+    {29, 0, "cooling_chamber"},
+    {30, 0, "paused_user_gcode"},
+    {31, 0, "motor_noise_showoff"},
+    {32, STAGE_ERROR, "paused_nozzle_filament_covered_detected"},
+    {33, STAGE_ERROR, "paused_cutter_error"},
+    {34, STAGE_ERROR, "paused_first_layer_error"},
+    {35, STAGE_ERROR, "paused_nozzle_clog"}
 };
 
-std::set<int> MQTTBroker::CAMERA_OFF_STAGES = {
-    //1, 8, 9, 10, 12, 14, 18, 19
-    8, 9, 10, 12, 18, 19
-};
+static const int NUM_STAGES = 36;
 
-std::set<int> MQTTBroker::IDLE_STAGES = {
-    -1, 255
-};
+// stg_cur when the printer isn't doing anything, -1 on some firmware and 255 on others
+static constexpr StageDescriptor IDLE_STAGE = {-1, STAGE_IDLE, "idle"};
+// A stage newer than this table, treated as plain printing
+static constexpr StageDescriptor UNKNOWN_STAGE = {-1, 0, "unknown"};
+
+static constexpr bool isIndexed(const StageDescriptor *stages, int count, int id = 0) {
+    return id == count || (stages[id].id == id && isIndexed(stages, count, id + 1));
+}
+
+static_assert(sizeof(STAGES) / sizeof(STAGES[0]) == NUM_STAGES, "STAGES must have an entry for every known stage");
+static_assert(isIndexed(STAGES, NUM_STAGES), "STAGES must be in stage order, with no gaps");
+
+static const StageDescriptor& getStage(int stage) {
+    if (stage >= 0 && stage < NUM_STAGES) {
+        return STAGES[stage];
+    }
+    return stage == -1 || stage == 255 ? IDLE_STAGE : UNKNOWN_STAGE;
+}
+
+const char* MQTTBroker::getStageName(int stage) {
+    return getStage(stage).name;
+}
 
 // convert some print_error codes into warnings
-std::set<int> MQTTBroker::PRINT_WARNINGS = {
+static constexpr int PRINT_WARNINGS[] = {
     0x03008011, 0x0C00800A
 };
 
+static bool isPrintWarning(int printError) {
+    for (int warning : PRINT_WARNINGS) {
+        if (warning == printError) {
+            return true;
+        }
+    }
+    return false;
+}
 
 /*
         # Example payload:
@@ -95,118 +125,8 @@ std::set<int> MQTTBroker::PRINT_WARNINGS = {
         #         "code": 65543     # In hex this is 0001 0007
         #     }
         # ],
-        # So this is HMS_0300_0100_0001_0007:
+        # So this is HMS_0300_0100_0001_0007, see HmsDatabase for the descriptions
 */
-std::map<uint64_t, std::string> MQTTBroker::HMS_ERRORS = {
-    {0x0300100000020001, "The 1st order mechanical resonance mode of X axis is low."},
-    {0x0300100000020002, "The 1st order mechanical resonance mode of X axis differ much..."},
-    {0x03000F0000010001, "The accelerometer data is unavailable"},
-    {0x03000D000001000B, "The Z axis motor seems got stuck when moving up"},
-    {0x03000D0000010002, "Hotbed homing failed. The environmental vibration is too great"},
-    {0x03000D0000010003, "The build plate is not placed properly ..."},
-    {0x03000D0000020001, "Heatbed homing abnormal. There may be a bulge on the ..."},
-    {0x03000A0000010005, "the static voltage of force sensor 1/2/3 is not 0 ..."},
-    {0x03000A0000010004, "External disturbance was detected when testing the force sensor"},
-    {0x03000A0000010003, "The sensitivity of heatbed force sensor 1/2/3 is too low...."},
-    {0x03000A0000010002, "The sensitivity of heatbed force sensor 1/2/3 is low..."},
-    {0x03000A0000010001, "The sensitivity of heatbed force sensor 1/2/3 is too high..."},
-    {0x0300040000020001, "The speed of part cooling fan if too slow or stopped ..."},
-    {0x0300030000020002, "The speed of hotend fan is slow ..."},
-    {0x0300030000010001, "The speed of the hotend fan is too slow or stopped..."},
-    {0x0300060000010001, "Motor-A has an open-circuit. There may be a loose connection, or the motor may have failed."},
-    {0x0300060000010002, "Motor-A has a short-circuit. It may have failed."},
-    {0x0300060000010003, "The resistance of Motor-A is abnormal, the motor may have failed."},
-    {0x0300010000010001, "The heatbed temperature is abnormal, the heater may have a short circuit."},
-    {0x0300010000010002, "The heatbed temperature is abnormal, the heater may have an open circuit, or the thermal switch may be open."},
-    {0x0300010000010003, "The heatbed temperature is abnormal, the heater is over temperature."},
-    {0x0300010000010006, "The heatbed temperature is abnormal, the sensor may have a short circuit."},
-    {0x0300010000010007, "The heatbed temperature is abnormal, the sensor may have an open circuit."},
-    {0x0300130000010001, "The current sensor of Motor-A is abnormal. This may be caused by a failure of the hardware sampling circuit."},
-    {0x0300400000020001, "Data transmission over the serial port is abnormal, the software system may be faulty."},
-    {0x0300410000010001, "The system voltage is unstable, triggering the power failure protection function."},
-    {0x0300020000010001, "The nozzle temperature is abnormal, the heater may be short circuit."},
-    {0x0300020000010002, "The nozzle temperature is abnormal, the heater may be open circuit."},
-    {0x0300020000010003, "The nozzle temperature is abnormal, the heater is over temperature."},
-    {0x0300020000010006, "The nozzle temperature is abnormal, the sensor may be short circuit."},
-    {0x0300020000010007, "The nozzle temperature is abnormal, the sensor may be open circuit."},
-    {0x0300120000020001, "The front cover of the toolhead fell off."},
-    {0x0C00010000010001, "The Micro Lidar camera is offline."},
-    {0x0700010000010001, "AMS1 assist motor has slipped. The extrusion wheel may be worn down, or the filament may be too thin."},
-    {0x0700010000010003, "AMS1 assist motor torque control is malfunctioning. The current sensor may be faulty."},
-    {0x0700010000010004, "AMS1 assist motor speed control is malfunctioning. The speed sensor may be faulty."},
-    {0x0700010000020002, "AMS1 assist motor is overloaded. The filament may be tangled or stuck."},
-    {0x0700020000010001, "AMS1 filament speed and length error. The filament odometry may be faulty."},
-    {0x0700100000010001, "AMS1 slot 1 motor has slipped. The extrusion wheel may be malfunctioning, or the filament may be too thin."},
-    {0x0700100000010003, "AMS1 slot 1 motor torque control is malfunctioning. The current sensor may be faulty."},
-    {0x0700100000020002, "AMS1 slot 1 motor is overloaded. The filament may be tangled or stuck."},
-    {0x0700200000020001, "AMS1 slot 1 filament has run out."},
-    {0x0700200000020002, "AMS1 slot 1 is empty."},
-    {0x0700200000020003, "AMS1 slot 1 filament may be broken in AMS."},
-    {0x0700200000020004, "AMS1 slot 1 filament may be broken in the tool head."},
-    {0x0700200000020005, "AMS1 slot 1 filament has run out, and purging the old filament went abnormally, please check whether the filament is stuck in the tool head."},
-    {0x0700200000030001, "AMS1 slot 1 filament has run out. Please wait while old filament is purged."},
-    {0x0700200000030002, "AMS1 slot 1 filament has run out and automatically switched to the slot with the same filament."},
-    {0x0700600000020001, "AMS1 slot 1 is overloaded. The filament may be tangled or the spool may be stuck."},
-    {0x0C00010000020002, "The Micro Lidar camera is malfunctioning."},
-    {0x0C00010000010003, "Synchronization between Micro Lidar camera and MCU is abnormal."},
-    {0x0C00010000010004, "The Micro Lidar camera lens seems to be dirty."},
-    {0x0C00010000010005, "Micro Lidar OTP parameter is abnormal."},
-    {0x0C00010000020006, "Micro Lidar extrinsic parameter abnormal."},
-    {0x0C00010000020007, "Micro Lidar laser parameters are drifted."},
-    {0x0C00010000020008, "Failed to get image from chamber camera."},
-    {0x0C00010000010009, "Chamber camera dirty."},
-    {0x0C0001000001000A, "The Micro Lidar LED may be broken."},
-    {0x0C0001000001000B, "Failed to calibrate Micro Lidar."},
-    {0x0C00020000010001, "The horizontal laser is not lit."},
-    {0x0C00020000020002, "The horizontal laser is too thick."},
-    {0x0C00020000020003, "The horizontal laser is not bright enough."},
-    {0x0C00020000020004, "Nozzle height seems too low."},
-    {0x0C00020000010005, "A new Micro Lidar is detected."},
-    {0x0C00020000020006, "Nozzle height seems too high."},
-    {0x0C00030000020001, "Filament exposure metering failed."},
-    {0x0C00030000020002, "First layer inspection terminated due to abnormal lidar data."},
-    {0x0C00030000020004, "First layer inspection not supported for current print."},
-    {0x0C00030000020005, "First layer inspection timeout."},
-    {0x0C00030000030006, "Purged filaments may have piled up."},
-    {0x0C00030000030007, "Possible first layer defects."},
-    {0x0C00030000030008, "Possible spaghetti defects were detected."},
-    {0x0C00030000010009, "The first layer inspection module rebooted abnormally."},
-    {0x0C0003000003000B, "Inspecting first layer."},
-    {0x0C0003000002000C, "The build plate localization marker is not detected."},
-    {0x0500010000020001, "The media pipeline is malfunctioning."},
-    {0x0500010000020002, "USB camera is not connected."},
-    {0x0500010000020003, "USB camera is malfunctioning."},
-    {0x0500010000030004, "Not enough space in SD Card."},
-    {0x0500010000030005, "Error in SD Card."},
-    {0x0500010000030006, "Unformatted SD Card."},
-    {0x0500020000020001, "Failed to connect internet, please check the network connection."},
-    {0x0500020000020002, "Failed to login device."},
-    {0x0500020000020004, "Unauthorized user."},
-    {0x0500020000020006, "Liveview service is malfunctioning."},
-    {0x0500030000010001, "The MC module is malfunctioning. Please restart the device."},
-    {0x0500030000010002, "The toolhead is malfunctioning. Please restart the device."},
-    {0x0500030000010003, "The AMS module is malfunctioning. Please restart the device."},
-    {0x050003000001000A, "System state is abnormal. Please restore factory settings."},
-    {0x050003000001000B, "The screen is malfunctioning."},
-    {0x050003000002000C, "Wireless hardware error. Please turn off/on WiFi or restart the device."},
-    {0x0500040000010001, "Failed to download print job. Please check your network connection."},
-    {0x0500040000010002, "Failed to report print state. Please check your network connection."},
-    {0x0500040000010003, "The content of print file is unreadable. Please resend the print job."},
-    {0x0500040000010004, "The print file is unauthorized."},
-    {0x0500040000010006, "Failed to resume previous print."},
-    {0x0500040000020007, "The bed temperature exceeds the filament's vitrification temperature, which may cause a nozzle clog."},
-    {0x0700400000020001, "The filament buffer signal lost, the cable or position sensor may be malfunctioning."},
-    {0x0700400000020002, "The filament buffer position signal error, the position sensor may be malfunctioning."},
-    {0x0700400000020003, "The AMS Hub communication is abnormal, the cable may be not well connected."},
-    {0x0700400000020004, "The filament buffer signal is abnormal, the spring may be stuck."},
-    {0x0700450000020001, "The filament cutter sensor is malfunctioning. The sensor may be disconnected or damaged."},
-    {0x0700450000020002, "The filament cutter's cutting distance is too large. The XY motor may lose steps."},
-    {0x0700450000020003, "The filament cutter handle has not released. The handle or blade may be stuck."},
-    {0x0700510000030001, "AMS is disabled, please load filament from spool holder."},
-    {0x07FF200000020001, "External filament has run out, please load a new filament."},
-    {0x07FF200000020002, "External filament is missing, please load a new filament."},
-    {0x07FF200000020004, "Please pull out the filament on the spool holder from the extruder."}
-};
 
 /*
 def get_HMS_severity(code: int) -> str:
@@ -215,107 +135,316 @@ def get_HMS_severity(code: int) -> str:
         return HMS_SEVERITY_LEVELS[uint_code]
     return HMS_SEVERITY_LEVELS["default"]
 */
-std::map<int, std::string> MQTTBroker::HMS_SEVERITY_LEVELS = {
-    {1, "fatal"},
-    {2, "serious"},
-    {3, "common"},
-    {4, "info"}
+// Indexed by the top half of the HMS code
+static constexpr const char *HMS_SEVERITY_LEVELS[] = {
+    "default", "fatal", "serious", "common", "info"
 };
 
 MQTTBroker::MQTTBroker() : client(espMqttClientTypes::UseInternalTask::YES) {
+    snapshotQueue = xQueueCreate(1, sizeof(Snapshot));
+    publishedMutex = xSemaphoreCreateMutex();
+
+    // So each consumer starts by picking everything up
+    for (int i=0; i < num_consumers; i++) {
+        pendingChanges[i] = PrinterState::ALL;
+    }
+
 	filter["print"]["stg_cur"] = true;
 	filter["print"]["hms"] = true;
     filter["print"]["print_error"] = true;
 	filter["print"]["home_flag"] = true;
 	filter["print"]["lights_report"] = true;
+	filter["print"]["mc_percent"] = true;
+	filter["print"]["layer_num"] = true;
+	filter["print"]["total_layer_num"] = true;
+	filter["print"]["gcode_state"] = true;
+	filter["print"]["mc_remaining_time"] = true;
+	filter["print"]["nozzle_temper"] = true;
+	filter["print"]["nozzle_target_temper"] = true;
+	filter["print"]["bed_temper"] = true;
+	filter["print"]["bed_target_temper"] = true;
+	filter["print"]["chamber_temper"] = true;
+	filter["print"]["cooling_fan_speed"] = true;
+	filter["print"]["big_fan1_speed"] = true;
+	filter["print"]["big_fan2_speed"] = true;
+	filter["print"]["heatbreak_fan_speed"] = true;
+	filter["print"]["ams"]["ams"][0]["id"] = true;
+	filter["print"]["ams"]["ams"][0]["tray"][0]["id"] = true;
+	filter["print"]["ams"]["ams"][0]["tray"][0]["tray_color"] = true;
+	filter["print"]["ams"]["ams"][0]["tray"][0]["remain"] = true;
 }
 
-void MQTTBroker::setStateChangedCallback(std::function<void(MQTTBroker*)> callback) {
+void MQTTBroker::setStateChangedCallback(std::function<void(MQTTBroker*, uint32_t)> callback, uint32_t fields) {
     stateChangedCallback = callback;
+    callbackFields = fields;
+}
+
+void MQTTBroker::setNotifyTask(TaskHandle_t task, uint32_t fields) {
+    notifyTask = task;
+    notifyFields = fields;
+}
+
+bool MQTTBroker::receiveSnapshot(Snapshot& snapshot) {
+    return xQueueReceive(snapshotQueue, &snapshot, 0) == pdTRUE;
 }
 
+void MQTTBroker::getSnapshot(Snapshot& snapshot) {
+    xSemaphoreTake(publishedMutex, portMAX_DELAY);
+    snapshot = published;
+    xSemaphoreGive(publishedMutex);
+}
+
+void MQTTBroker::notifyStateChanged(uint32_t changed) {
+    stateChanges++;
+
+    // Before anyone is told, so whoever takes these changes finds them in it
+    xSemaphoreTake(publishedMutex, portMAX_DELAY);
+    published.state = state;
+    published.printer = printer;
+    published.changed = changed;
+    published.receivedMicros = eventMicros;
+    xSemaphoreGive(publishedMutex);
+
+    for (int i=0; i < num_consumers; i++) {
+        __atomic_fetch_or(&pendingChanges[i], changed, __ATOMIC_RELEASE);
+    }
+    if (changed & callbackFields) {
+        stateChangedCallback(this, changed & callbackFields);
+    }
+    if (notifyTask && (changed & notifyFields)) {
+        // Static, as two of them are a bit much for the parse task's stack
+        static Snapshot snapshot;
+        static Snapshot unread;
+        snapshot.changed = changed;
+        snapshot.receivedMicros = eventMicros;
+
+        // This replaces the last one if it hasn't been picked up yet, so carry its changes over
+        if (xQueuePeek(snapshotQueue, &unread, 0) == pdTRUE) {
+            snapshot.changed |= unread.changed;
+            snapshot.receivedMicros = unread.receivedMicros;
+        }
+
+        snapshot.state = state;
+        snapshot.printer = printer;
+        xQueueOverwrite(snapshotQueue, &snapshot);
+        xTaskNotifyGive(notifyTask);
+    }
+}
+
+// Sets field to value if it isn't null, noting bit in changed if that changed it
+template<class T>
+static void update(JsonVariantConst value, T& field, uint32_t bit, uint32_t& changed) {
+    if (!value.isNull()) {
+        T newValue = value.as<T>();
+        if (field != newValue) {
+            field = newValue;
+            changed |= bit;
+        }
+    }
+}
+
+
+void MQTTBroker::wakeParser() {
+    if (parseTask) {
+        xTaskNotifyGive(parseTask);
+    }
+}
 
 void MQTTBroker::onConnect(bool sessionPresent)
 {
-    connected = true;
-    state = idle;
 	reconnect = false;
-    lightOn = true;
 	Serial.println("Connected to Printer");
 	Serial.print("Session present: ");
 	Serial.println(sessionPresent);
 	uint16_t packetIdSub = client.subscribe(reportTopic, 0);
 	Serial.print("Subscribing at QoS 0, packetId: ");
 	Serial.println(packetIdSub);
-    stateChangedCallback(this);
+
+    connectionMicros = micros();
+    __atomic_store_n(&clientConnected, true, __ATOMIC_RELEASE);
+    __atomic_store_n(&connectionChanged, true, __ATOMIC_RELEASE);
+    wakeParser();
 }
 
 void MQTTBroker::onDisconnect(espMqttClientTypes::DisconnectReason reason)
 {
 	Serial.printf("Disconnected from Printer: %u\n", static_cast<uint8_t>(reason));
 
-    connected = false;
-    state = disconnected;
     reconnect = true;
     lastReconnect = millis();
-    stateChangedCallback(this);
+
+    connectionMicros = micros();
+    __atomic_store_n(&clientConnected, false, __ATOMIC_RELEASE);
+    __atomic_store_n(&connectionChanged, true, __ATOMIC_RELEASE);
+    wakeParser();
+}
+
+// On the parse task, catches the state up with the last connect or disconnect
+uint32_t MQTTBroker::updateConnection() {
+    if (__atomic_load_n(&clientConnected, __ATOMIC_ACQUIRE)) {
+        printer.connected = true;
+        state = idle;
+        printer.lightOn = true;
+        return PrinterState::CONNECTION | PrinterState::STATE | PrinterState::CHAMBER_LIGHT;
+    }
+
+    // Anything still waiting is from before the disconnect
+    size_t length;
+    uint32_t receivedMicros;
+    while (reportRing.beginRead(length, receivedMicros)) {
+        reportRing.endRead();
+    }
+
+    printer.connected = false;
+    state = disconnected;
+    return PrinterState::CONNECTION | PrinterState::STATE;
+}
+
+void MQTTBroker::runParser() {
+    parseTask = xTaskGetCurrentTaskHandle();
+
+    while (true) {
+        // Anything that arrived before we got here gets picked up first time round
+        parsePending();
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+uint32_t MQTTBroker::parsePending() {
+    uint32_t changed = 0;
+    if (__atomic_exchange_n(&connectionChanged, false, __ATOMIC_ACQUIRE)) {
+        changed |= updateConnection();
+        eventMicros = connectionMicros;
+    }
+
+    // Everything that has come in since we last looked, oldest first, notified as one change
+    uint8_t batch = 0;
+    size_t length;
+    uint32_t receivedMicros;
+    const char *report;
+    while ((report = reportRing.beginRead(length, receivedMicros)) != 0) {
+        if (!changed) {
+            eventMicros = receivedMicros;
+        }
+        changed |= parseReport(report, length);
+        reportRing.endRead();
+        batch++;
+    }
+    if (batch > 1) {
+        coalescedReports += batch - 1;
+    }
+
+    if (changed) {
+        notifyStateChanged(changed);
+    }
+
+    return changed;
 }
 
 void MQTTBroker::setChamberLight(bool on) {
-    if (connected) {
+    if (__atomic_load_n(&clientConnected, __ATOMIC_ACQUIRE)) {
         client.publish(requestTopic, 0, false, on ? CHAMBER_LIGHT_ON : CHAMBER_LIGHT_OFF);
     }
 }
 
-void MQTTBroker::handleMQTTMessage(JsonDocument &jsonMsg) {
+uint32_t MQTTBroker::handleMQTTMessage(JsonDocument &jsonMsg) {
     // serializeJson(jsonMsg, Serial);
     // Serial.println("");
 
-    bool stateChanged = false;
+    uint32_t changed = 0;
+    State oldState = state;
 
     JsonVariant printValues = jsonMsg["print"];
     if (printValues) {
         if (printValues.containsKey("home_flag")) {
-            bool oldDoorOpen = doorOpen;
             // "home_flag" value is a signed 32 bit int as a string. .as<uint32_t>() will fail if
             // the high bit is set, so we use as<int32_t>() first then cast to uint32_t.
             uint32_t payload = printValues["home_flag"].as<int32_t>();
-            doorOpen = (payload & 0x00800000) != 0;
-            stateChanged = stateChanged || (oldDoorOpen != doorOpen);
+            bool doorOpen = (payload & 0x00800000) != 0;
+            if (printer.doorOpen != doorOpen) {
+                printer.doorOpen = doorOpen;
+                changed |= PrinterState::DOOR;
+            }
         }
 
         if (printValues.containsKey("stg_cur")) {
-            int stage = printValues["stg_cur"];
-            State oldState = state;
-            if (ERROR_STAGES.count(stage) > 0) {
+            int stageId = printValues["stg_cur"];
+            const StageDescriptor& stage = getStage(stageId);
+            if (stage.flags & STAGE_ERROR) {
                 state = error;
-            } else if (CAMERA_OFF_STAGES.count(stage) > 0) {
+            } else if (stage.flags & STAGE_CAMERA_OFF) {
                 state = no_lights;
-            } else if (IDLE_STAGES.count(stage) > 0) {
+            } else if (stage.flags & STAGE_IDLE) {
                 state = idle;
             } else {
                 state = printing;
             }
-            stateChanged = stateChanged || (oldState != state);
+            if (printer.stage != stageId) {
+                printer.stage = stageId;
+                changed |= PrinterState::STAGE;
+                Serial.print("Stage=");Serial.println(stage.name);
+            }
+        }
+
+        const char *gcodeState = printValues["gcode_state"];
+        if (gcodeState && strncmp(printer.gcodeState, gcodeState, sizeof(printer.gcodeState) - 1) != 0) {
+            strlcpy(printer.gcodeState, gcodeState, sizeof(printer.gcodeState));
+            changed |= PrinterState::GCODE_STATE;
         }
 
-        JsonVariant lights = printValues["lights_report"];
-        if (lights) {
-            bool oldLightOn = lightOn;
-            JsonArray lightsArray = lights.as<JsonArray>();
-            for (int i=0; i<lightsArray.size(); i++) {
-                if (lightsArray[i]["node"].as<String>() == "chamber_light") {
-                    lightOn = lightsArray[i]["mode"].as<String>() == "on";
+        update(printValues["mc_percent"], printer.percent, PrinterState::PROGRESS, changed);
+        update(printValues["mc_remaining_time"], printer.remainingMinutes, PrinterState::PROGRESS, changed);
+        update(printValues["layer_num"], printer.layer, PrinterState::LAYER, changed);
+        update(printValues["total_layer_num"], printer.totalLayers, PrinterState::LAYER, changed);
+        update(printValues["nozzle_temper"], printer.nozzleTemp, PrinterState::NOZZLE_TEMP, changed);
+        update(printValues["nozzle_target_temper"], printer.nozzleTarget, PrinterState::NOZZLE_TEMP, changed);
+        update(printValues["bed_temper"], printer.bedTemp, PrinterState::BED_TEMP, changed);
+        update(printValues["bed_target_temper"], printer.bedTarget, PrinterState::BED_TEMP, changed);
+        update(printValues["chamber_temper"], printer.chamberTemp, PrinterState::CHAMBER_TEMP, changed);
+        // Fan speeds are numbers as strings, which as<>() converts
+        update(printValues["cooling_fan_speed"], printer.partFan, PrinterState::FANS, changed);
+        update(printValues["big_fan1_speed"], printer.auxFan, PrinterState::FANS, changed);
+        update(printValues["big_fan2_speed"], printer.chamberFan, PrinterState::FANS, changed);
+        update(printValues["heatbreak_fan_speed"], printer.heatbreakFan, PrinterState::FANS, changed);
+
+        JsonArray lightsArray = printValues["lights_report"];
+        for (JsonVariant light : lightsArray) {
+            if (light["node"] == "chamber_light") {
+                bool lightOn = light["mode"] == "on";
+                if (printer.lightOn != lightOn) {
+                    printer.lightOn = lightOn;
+                    changed |= PrinterState::CHAMBER_LIGHT;
+                }
+            }
+        }
+
+        // Each AMS and tray has an id, which is a number as a string
+        JsonArray amsArray = printValues["ams"]["ams"];
+        for (JsonVariant ams : amsArray) {
+            uint8_t amsId = ams["id"].as<uint8_t>();
+            JsonArray trayArray = ams["tray"];
+            for (JsonVariant tray : trayArray) {
+                uint8_t trayId = tray["id"].as<uint8_t>();
+                if (amsId >= PrinterState::MAX_AMS || trayId >= PrinterState::TRAYS_PER_AMS) {
+                    continue;
+                }
+
+                // Empty trays are sent with just their id
+                PrinterState::Tray& slot = printer.trays[amsId * PrinterState::TRAYS_PER_AMS + trayId];
+                uint32_t color = strtoul(tray["tray_color"] | "0", 0, 16);
+                int8_t remain = tray["remain"] | -1;
+                if (slot.color != color || slot.remain != remain) {
+                    slot.color = color;
+                    slot.remain = remain;
+                    changed |= PrinterState::AMS;
                 }
             }
-            stateChanged = stateChanged || (oldLightOn != lightOn);
         }
 
         JsonVariant hms = printValues["hms"];
         if (hms) {
             JsonArray hmsArray = hms.as<JsonArray>();
             if (hmsArray.size() > 0) {
-                State oldState = state;
                 state = error;
                 for (int i=0; i<hmsArray.size(); i++) {
                     // Bear in mind that the JSON values are signed integers as strings. So we have to convert
@@ -324,7 +453,9 @@ void MQTTBroker::handleMQTTMessage(JsonDocument &jsonMsg) {
                     uint64_t code = hmsArray[i]["code"].as<int64_t>();
                     int level = code >> 16;
                     uint64_t value = (attr << 32) | code;
-                    Serial.print("HMS value=");Serial.println(HMS_ERRORS[value].c_str());
+                    char message[HmsDatabase::MAX_MESSAGE];
+                    HmsDatabase::describe(value, message, sizeof(message));
+                    Serial.print("HMS value=");Serial.println(message);
                     if (value == 0x0C0003000003000B) {
                         state = no_lights;
                         break;
@@ -336,35 +467,43 @@ void MQTTBroker::handleMQTTMessage(JsonDocument &jsonMsg) {
                         state = error;
                     }
                 }
-                stateChanged = stateChanged || (oldState != state);               
             }
         }
 
         if (printValues.containsKey("print_error")) {
             int printError = printValues["print_error"].as<int32_t>();
             if (printError > 0) {
-                State oldState = state;
+                char message[HmsDatabase::MAX_MESSAGE];
+                HmsDatabase::describe(printError, message, sizeof(message));
+                Serial.print("Print error=");Serial.println(message);
                 state = error;
-                if (PRINT_WARNINGS.count(printError) > 0) {
+                if (isPrintWarning(printError)) {
                     state = warning;
                 }
-                stateChanged = stateChanged || (oldState != state);               
             }
         }
     }
 
-    if (stateChanged) {
-        stateChangedCallback(this);
+    if (state != oldState) {
+        changed |= PrinterState::STATE;
     }
+
     // Serial.print("printer state=");Serial.println(state);
+    return changed;
 }
 
-void MQTTBroker::onCompleteMessage(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t length) {
-	JsonDocument jsonMsg;
-	DeserializationError deserializeError = deserializeJson(jsonMsg, payload, length, DeserializationOption::Filter(filter));
+// On the parse task, returns the PrinterState fields that changed
+uint32_t MQTTBroker::parseReport(const char* payload, size_t length) {
+	uint32_t startMicros = micros();
+	uint32_t changed = 0;
+	parseAllocator.reset();
+
+	JsonDocument jsonMsg(&parseAllocator);
+	// Already filtered by reportFilter
+	DeserializationError deserializeError = deserializeJson(jsonMsg, payload, length);
 	if (!deserializeError) {
 		if (jsonMsg.containsKey("print")) {
-			handleMQTTMessage(jsonMsg);
+			changed = handleMQTTMessage(jsonMsg);
 		} else {
 			serializeJson(jsonMsg, Serial);
 			Serial.println("");
@@ -373,25 +512,53 @@ void MQTTBroker::onCompleteMessage(const espMqttClientTypes::MessageProperties&
 		Serial.print(F("Deserialize error while parsing mqtt message: "));
 		Serial.println(deserializeError.c_str());
 	}
+
+	parseTimes.add(micros() - startMicros);
+	parseAllocations = parseAllocator.getAllocations();
+	if (parseAllocator.getPeakBytes() > parsePeakBytes) {
+		parsePeakBytes = parseAllocator.getPeakBytes();
+	}
+
+	return changed;
 }
 
 
 void MQTTBroker::onMessage(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t length, size_t index, size_t total_length)
 {
-	static uint8_t mqttMessageBuffer[16384];
-
-		// payload is bigger then max: return chunked
-	if (total_length >= sizeof(mqttMessageBuffer)) {
-		DEBUG("MQTT message too large");
-		return;
+	uint32_t startMicros = micros();
+
+	// Filter each fragment as it arrives, so only the few keys we look at are ever held in memory.
+	// What is kept goes straight into the ring, for the parse task to pick up.
+	if (index == 0) {
+		reportFilter.begin(filter.as<JsonVariantConst>(), reportRing.beginWrite(), ReportRing::SLOT_SIZE);
+		filterMicros = 0;
+		reportMicros = startMicros;
 	}
 
-	// add data and dispatch when done
-	memcpy(&mqttMessageBuffer[index], payload, length);
+	reportFilter.feed((const char*)payload, length);
+	filterMicros += micros() - startMicros;
+
 	if (index + length == total_length) {
 		// message is complete here
-		mqttMessageBuffer[total_length] = 0;
-        onCompleteMessage(properties, topic, mqttMessageBuffer, total_length);
+		reports++;
+		filterTimes.add(filterMicros);
+		if (total_length > largestReport) {
+			largestReport = total_length;
+		}
+
+		if (reportFilter.isComplete() && reportFilter.getKept() == 0 && skipReports) {
+			// None of the keys we look at, so don't bother the parse task with it
+			reportRing.abort();
+			skippedReports++;
+		} else if (reportFilter.isComplete()) {
+			reportRing.commit(reportFilter.getLength(), reportMicros);
+			wakeParser();
+		} else {
+			reportRing.abort();
+			droppedReports++;
+			Serial.print(F("Error while filtering mqtt message: "));
+			Serial.println(reportFilter.getError());
+		}
 	}
 }
 
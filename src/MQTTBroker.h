@@ -4,7 +4,11 @@
 #include <espMqttClient.h>
 #include <ArduinoJson.h>
 #include <map>
-#include <set>
+#include "JsonStreamFilter.h"
+#include "ReportRing.h"
+#include "CountingAllocator.h"
+#include "LatencyHistogram.h"
+#include "PrinterState.h"
 
 class MQTTBroker
 {
@@ -12,6 +16,16 @@ public:
     MQTTBroker();
 
     enum State { disconnected, idle, printing, no_lights, error, warning };
+    // Consumers that collect changes with takeChanges() rather than being called back
+    enum Consumer { web, num_consumers };
+
+    // A copy of everything, sent to the notify task whenever a field it wants changes
+    struct Snapshot {
+        State state = disconnected;
+        PrinterState printer;
+        uint32_t changed = 0;         // Fields changed since the last snapshot that was received
+        uint32_t receivedMicros = 0;  // When the oldest report behind those changes arrived
+    };
 
     static StringConfigItem& getHost() { static StringConfigItem mqtt_host("mqtt_host", 25, ""); return mqtt_host; }
     static IntConfigItem& getPort() { static IntConfigItem mqtt_port("mqtt_port", 8883); return mqtt_port; }
@@ -19,49 +33,112 @@ public:
     static StringConfigItem& getPassword() { static StringConfigItem mqtt_password("mqtt_password", 25, ""); return mqtt_password; }
     static StringConfigItem& getSerialNumber() { static StringConfigItem mqtt_serialnumber("mqtt_serialnumber", 25, ""); return mqtt_serialnumber; }
 
-    void setStateChangedCallback(std::function<void(MQTTBroker *)> callback);
+    // Called, on the parse task, with the PrinterState fields that changed, when any of fields have
+    void setStateChangedCallback(std::function<void(MQTTBroker *, uint32_t)> callback, uint32_t fields = PrinterState::ALL);
+    // Task to be sent a Snapshot, and a task notification, whenever any of fields change
+    void setNotifyTask(TaskHandle_t task, uint32_t fields = PrinterState::ALL);
+    // For the notify task, true if there was a new snapshot
+    bool receiveSnapshot(Snapshot& snapshot);
+    // For any other task: the state as of the last change notified. Leaves the notify task's snapshot alone.
+    void getSnapshot(Snapshot& snapshot);
+    // The PrinterState fields that have changed since consumer last asked
+    uint32_t takeChanges(Consumer consumer) { return __atomic_exchange_n(&pendingChanges[consumer], 0, __ATOMIC_ACQUIRE); }
     bool init(const String& id);
+    // Body of the task that parses reports and updates the state, never returns
+    void runParser();
+    // One pass of runParser(): catches up with everything that has come in, notifies and returns what changed
+    uint32_t parsePending();
     void connect();
     void checkConnection();
-    bool isConnected() { return connected; }
-    bool isDoorOpen() { return doorOpen; }
-    bool isLightOn() { return lightOn; }
+    bool isConnected() { return printer.connected; }
+    bool isDoorOpen() { return printer.doorOpen; }
+    bool isLightOn() { return printer.lightOn; }
     State getState() { return state; }
+    uint8_t getPercent() { return printer.percent; }
+    uint16_t getLayer() { return printer.layer; }
+    uint16_t getTotalLayers() { return printer.totalLayers; }
+    // Updated in place on the parse task, so only safe to read there, e.g. from the state changed
+    // callback. Other tasks should use getSnapshot().
+    const PrinterState& getPrinterState() const { return printer; }
     void setChamberLight(bool on);
 
+    static const char* getStageName(int stage);
+
+    // How the report handling is doing, for the Info page
+    uint32_t getReportCount() const { return reports; }
+    uint32_t getDroppedReports() const { return droppedReports; }
+    // Reports with nothing in them we look at, so never parsed
+    uint32_t getSkippedReports() const { return skippedReports; }
+    // On unless turned off, which is only for measuring what skipping saves
+    void setSkipReports(bool skip) { skipReports = skip; }
+    uint32_t getStateChanges() const { return stateChanges; }
+    size_t getLargestReport() const { return largestReport; }
+    size_t getLargestFiltered() const { return reportFilter.getMaxLength(); }
+    uint8_t getQueueDepth() const { return reportRing.getDepth(); }
+    uint8_t getMaxQueueDepth() const { return reportRing.getMaxDepth(); }
+    // Reports dropped unparsed because newer ones came in behind them
+    uint32_t getOverwrittenReports() const { return reportRing.getDropped(); }
+    // Reports parsed in a batch with others, so the change was only notified once
+    uint32_t getCoalescedReports() const { return coalescedReports; }
+    const LatencyHistogram& getFilterTimes() const { return filterTimes; }
+    const LatencyHistogram& getParseTimes() const { return parseTimes; }
+    uint32_t getParseAllocations() const { return parseAllocations; }
+    size_t getParsePeakBytes() const { return parsePeakBytes; }
+
 private:
     void onConnect(bool sessionPresent);
     void onDisconnect(espMqttClientTypes::DisconnectReason reason);
     void onMessage(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t*  payload, size_t length, size_t index, size_t total_length);
-    void onCompleteMessage(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t length);
-    void handleMQTTMessage(JsonDocument &jsonMsg);
+    uint32_t parseReport(const char* payload, size_t length);
+    uint32_t handleMQTTMessage(JsonDocument &jsonMsg);
+    uint32_t updateConnection();
+    void wakeParser();
+    void notifyStateChanged(uint32_t changed);
 
     String id;
     JsonDocument filter;
+    JsonStreamFilter reportFilter;
+    ReportRing reportRing;
+    TaskHandle_t parseTask = 0;
+    CountingAllocator parseAllocator;
+
+    uint32_t reports = 0;
+    uint32_t droppedReports = 0;
+    uint32_t skippedReports = 0;
+    bool skipReports = true;
+    uint32_t stateChanges = 0;
+    size_t largestReport = 0;
+    uint32_t filterMicros = 0;  // For the report currently arriving
+    uint32_t reportMicros = 0;  // When it started arriving
+    uint32_t coalescedReports = 0;
+    LatencyHistogram filterTimes;
+    LatencyHistogram parseTimes;
+    uint32_t parseAllocations = 0;  // For the last report
+    size_t parsePeakBytes = 0;      // Most any report has needed
     char deviceTopic[64];
     char reportTopic[64];
     char requestTopic[64];
 
     bool reconnect = false;
-    bool connected = false;
+    // Set on the MQTT task, the parse task brings the state up to date with them
+    bool clientConnected = false;
+    bool connectionChanged = false;
+    uint32_t connectionMicros = 0;
+    uint32_t eventMicros = 0;   // When whatever is being notified happened
     State state = disconnected;
-    bool doorOpen;
-    bool lightOn = true;
+    PrinterState printer;
+    uint32_t pendingChanges[num_consumers];
 
     uint32_t lastReconnect = 0;
 
     espMqttClientSecure client;
 
-    std::function<void(MQTTBroker*)> stateChangedCallback = [](MQTTBroker*) {};
-
-    static std::map<int, std::string> CURRENT_STAGE_IDS;
-    static std::map<uint64_t, std::string> HMS_ERRORS;
-    static std::map<int, std::string> HMS_SEVERITY_LEVELS;
-    
-    static std::set<int> ERROR_STAGES;
-    static std::set<int> CAMERA_OFF_STAGES;
-    static std::set<int> IDLE_STAGES;
-
-    static std::set<int> PRINT_WARNINGS;
+    std::function<void(MQTTBroker*, uint32_t)> stateChangedCallback = [](MQTTBroker*, uint32_t) {};
+    uint32_t callbackFields = PrinterState::ALL;
+    TaskHandle_t notifyTask = 0;
+    uint32_t notifyFields = PrinterState::ALL;
+    QueueHandle_t snapshotQueue;  // Holds one Snapshot, always the latest
+    Snapshot published;           // For getSnapshot(), only touched with publishedMutex held
+    SemaphoreHandle_t publishedMutex;
 };
 #endif
\ No newline at end of file
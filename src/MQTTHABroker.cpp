@@ -5,6 +5,7 @@
 #include <ConfigItem.h>
 #include <BambuLights.h>
 #include <MQTTBroker.h>
+#include <MessagePool.h>
 
 #include "MQTTHABroker.h"
 
@@ -54,6 +55,10 @@ void MQTTHABroker::onDisconnect(espMqttClientTypes::DisconnectReason reason)
     connected = false;
     reconnect = true;
     lastReconnect = millis();
+
+    // A message cut off part way through will never finish
+    MessagePool::release(fragments);
+    fragments = 0;
 }
 
 #ifdef ASYNC_MTTT_HA_CLIENT
@@ -62,60 +67,75 @@ void MQTTHABroker::onMessage(char* topic, char* payload, AsyncMqttClientMessageP
 void MQTTHABroker::onMessage(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t length, size_t index, size_t total_length)
 #endif
 {
-	static uint8_t mqttMessageBuffer[256];
+	// Almost every message arrives in one piece, so use it where it is
+	if (index == 0 && length == total_length) {
+		onCompleteMessage(topic, (const char*)payload, length);
+		return;
+	}
+
+	// Otherwise put it back together in a pooled buffer
+	if (index == 0) {
+		MessagePool::release(fragments);	// Last one never finished
+		fragments = 0;
+		if (total_length > MessagePool::BUFFER_SIZE) {
+			Serial.println(F("MQTT_HA message too large"));
+			return;
+		}
+		fragments = MessagePool::acquire();
+	}
 
-		// payload is bigger then max: return chunked
-	if (total_length >= sizeof(mqttMessageBuffer)) {
-		DEBUG("MQTT_HA message too large");
+	if (fragments == 0) {
 		return;
 	}
 
 	// add data and dispatch when done
-	memcpy(&mqttMessageBuffer[index], payload, length);
+	memcpy(&fragments[index], payload, length);
 	if (index + length == total_length) {
 		// message is complete here
-		mqttMessageBuffer[total_length] = 0;
-        onCompleteMessage(properties, topic, mqttMessageBuffer, total_length);
+        onCompleteMessage(topic, fragments, total_length);
+		MessagePool::release(fragments);
+		fragments = 0;
 	}
 }
 
-#ifdef ASYNC_MTTT_HA_CLIENT
-void MQTTHABroker::onCompleteMessage(char* topic, char* payload, AsyncMqttClientMessageProperties properties, size_t length)
-#else
-void MQTTHABroker::onCompleteMessage(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t length)
-#endif
+// The payload is not null terminated
+static bool payloadIs(const char* payload, size_t length, const char* value) {
+    return strlen(value) == length && memcmp(payload, value, length) == 0;
+}
+
+void MQTTHABroker::onCompleteMessage(const char* topic, const char* payload, size_t length)
 {
-    Serial.printf("Received message %s on topic %s\n", (char*)payload, topic);
+    Serial.printf("Received message %.*s on topic %s\n", (int)length, payload, topic);
 
     if (strcmp(topic, "homeassistant/status") == 0) {
-        if (strcmp("online", (const char*)payload)) {
+        if (payloadIs(payload, length, "online")) {
             Serial.println("HA online");
             sendHADiscoveryMessage();
         }
     } else if (strcmp(topic, chamberLightCommandTopic) == 0) {
-        if (strcmp((const char *)payload, "OFF") == 0) {
+        if (payloadIs(payload, length, "OFF")) {
             mqttBroker.setChamberLight(false);
-       } else if (strcmp((const char *)payload, "ON") == 0){
+       } else if (payloadIs(payload, length, "ON")){
             mqttBroker.setChamberLight(true);
         } else {
-            Serial.printf("Unknown chamber light %s\n", (const char *)payload);
+            Serial.printf("Unknown chamber light %.*s\n", (int)length, payload);
         }
         broadcastUpdate(BambuLights::getLightState().name, BambuLights::getLightState());
         publishLightState();
     } else if (strcmp(topic, lightCommandTopic) == 0) {
-        if (strcmp((const char *)payload, "OFF") == 0) {
+        if (payloadIs(payload, length, "OFF")) {
             BambuLights::getLightState() = false;
-       } else if (strcmp((const char *)payload, "ON") == 0){
+       } else if (payloadIs(payload, length, "ON")){
             BambuLights::getLightState() = true;
         } else {
-            Serial.printf("Unknown strip light %s\n", (const char *)payload);
+            Serial.printf("Unknown strip light %.*s\n", (int)length, payload);
         }
         broadcastUpdate(BambuLights::getLightState().name, BambuLights::getLightState());
         publishLightState();
     } else if (strcmp(topic, effectCommandTopic) == 0) {
         bool found = false;
         for (int i=0; effectNames[i] != 0; i++) {
-            if (strcmp(effectNames[i], (const char *)payload) == 0) {
+            if (payloadIs(payload, length, effectNames[i])) {
                 BambuLights::getLightMode() = i;
                 found = true;
                 break;
@@ -124,14 +144,13 @@ void MQTTHABroker::onCompleteMessage(const espMqttClientTypes::MessageProperties
         if (found) {
             broadcastUpdate(BambuLights::getLightMode().name, BambuLights::getLightMode());
         } else {
-            Serial.printf("Unknown light effect %s\n", (const char*)payload);
+            Serial.printf("Unknown light effect %.*s\n", (int)length, payload);
         }
         publishEffectState();
     } else {
         Serial.print("Unknown topic: ");
         Serial.print(topic);
-        Serial.print(", value: ");
-        Serial.println((const char*)payload);
+        Serial.printf(", value: %.*s\n", (int)length, payload);
     }
 }
 
@@ -152,7 +171,9 @@ void MQTTHABroker::onPrinterStateChanged(MQTTBroker* printerBroker) {
 
 bool MQTTHABroker::init(const String& id) {
     this->id = id;
-    mqttBroker.setStateChangedCallback([this](MQTTBroker* printerBroker) { onPrinterStateChanged(printerBroker); });
+    // Only what goes in the printer state message
+    mqttBroker.setStateChangedCallback([this](MQTTBroker* printerBroker, uint32_t changed) { onPrinterStateChanged(printerBroker); },
+        PrinterState::CONNECTION | PrinterState::STATE | PrinterState::DOOR | PrinterState::CHAMBER_LIGHT);
 
     client.disconnect();
 
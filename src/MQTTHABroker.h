@@ -29,12 +29,11 @@ private:
 #ifdef ASYNC_MTTT_HA_CLIENT
     void onDisconnect(AsyncMqttClientDisconnectReason reason);
     void onMessage(char* topic, char* payload, AsyncMqttClientMessageProperties properties, size_t length, size_t index, size_t total_length);
-    void onCompleteMessage(char* topic, char* payload, AsyncMqttClientMessageProperties properties, size_t length);
 #else
     void onDisconnect(espMqttClientTypes::DisconnectReason reason);
     void onMessage(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t*  payload, size_t length, size_t index, size_t total_length);
-    void onCompleteMessage(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t length);
 #endif
+    void onCompleteMessage(const char* topic, const char* payload, size_t length);
     void publishLightState();
     void publishEffectState();
     void sendHADiscoveryMessage();
@@ -54,6 +53,7 @@ private:
     bool connected = false;
     bool reconnect = false;
     uint32_t lastReconnect = 0;
+    char* fragments = 0;    // From MessagePool while a fragmented message is arriving
 
 #ifdef ASYNC_MTTT_HA_CLIENT
     AsyncMqttClient client;
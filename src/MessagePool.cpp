@@ -0,0 +1,25 @@
+#include "MessagePool.h"
+
+bool MessagePool::inUse[NUM_BUFFERS];
+char MessagePool::buffers[NUM_BUFFERS][BUFFER_SIZE];
+uint32_t MessagePool::exhausted = 0;
+
+char* MessagePool::acquire() {
+  for (uint8_t i=0; i < NUM_BUFFERS; i++) {
+    bool expected = false;
+    if (__atomic_compare_exchange_n(&inUse[i], &expected, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+      return buffers[i];
+    }
+  }
+
+  __atomic_fetch_add(&exhausted, 1, __ATOMIC_RELAXED);
+  return 0;
+}
+
+void MessagePool::release(char* buffer) {
+  if (buffer == 0) {
+    return;
+  }
+
+  __atomic_store_n(&inUse[(buffer - buffers[0]) / BUFFER_SIZE], false, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,34 @@
+#ifndef MESSAGEPOOL_H
+#define MESSAGEPOOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Buffers for putting MQTT messages back together when the client hands
+ * them over in fragments. Messages that arrive in one piece are used
+ * where they are and never need one.
+ *
+ * Each client holds a buffer from the first fragment of a message to the
+ * last, claiming it with a compare-and-swap, so clients running on
+ * different tasks never share one.
+ */
+class MessagePool {
+public:
+  static const uint8_t NUM_BUFFERS = 2;
+  static const size_t BUFFER_SIZE = 256;
+
+  // Returns a free buffer, or 0 if they are all in use
+  static char* acquire();
+  static void release(char* buffer);
+
+  // Messages dropped because no buffer was free
+  static uint32_t getExhausted() { return exhausted; }
+
+private:
+  static bool inUse[NUM_BUFFERS];
+  static char buffers[NUM_BUFFERS][BUFFER_SIZE];
+  static uint32_t exhausted;
+};
+
+#endif // MESSAGEPOOL_H
@@ -0,0 +1,59 @@
+#ifndef PRINTERSTATE_H
+#define PRINTERSTATE_H
+
+#include <stdint.h>
+
+/*
+ * What the printer has told us so far. Reports only carry the keys that
+ * changed, so each one updates the fields it has and leaves the rest
+ * alone. Every update comes with a mask of the fields that actually
+ * changed, so consumers only do something when one they look at has.
+ */
+struct PrinterState {
+  // Bits of the changed mask
+  static const uint32_t CONNECTION = 1 << 0;
+  static const uint32_t STATE = 1 << 1;           // MQTTBroker::State, what the lights show
+  static const uint32_t STAGE = 1 << 2;
+  static const uint32_t GCODE_STATE = 1 << 3;
+  static const uint32_t DOOR = 1 << 4;
+  static const uint32_t CHAMBER_LIGHT = 1 << 5;
+  static const uint32_t PROGRESS = 1 << 6;        // percent and remainingMinutes
+  static const uint32_t LAYER = 1 << 7;           // layer and totalLayers
+  static const uint32_t NOZZLE_TEMP = 1 << 8;     // Current and target
+  static const uint32_t BED_TEMP = 1 << 9;        // Current and target
+  static const uint32_t CHAMBER_TEMP = 1 << 10;
+  static const uint32_t FANS = 1 << 11;
+  static const uint32_t AMS = 1 << 12;
+  static const uint32_t ALL = (1 << 13) - 1;
+
+  static const uint8_t MAX_AMS = 4;
+  static const uint8_t TRAYS_PER_AMS = 4;
+
+  struct Tray {
+    uint32_t color = 0;   // RRGGBBAA, 0 when the tray is empty
+    int8_t remain = -1;   // Percent, -1 if unknown
+  };
+
+  bool connected = false;
+  int16_t stage = -1;
+  char gcodeState[12] = "";       // IDLE, PREPARE, RUNNING, PAUSE, FINISH, FAILED...
+  bool doorOpen = false;
+  bool lightOn = true;
+  uint8_t percent = 0;
+  uint16_t remainingMinutes = 0;
+  uint16_t layer = 0;
+  uint16_t totalLayers = 0;
+  float nozzleTemp = 0;
+  float nozzleTarget = 0;
+  float bedTemp = 0;
+  float bedTarget = 0;
+  float chamberTemp = 0;
+  // Fan speeds in the printer's 0-15 steps
+  uint8_t partFan = 0;
+  uint8_t auxFan = 0;
+  uint8_t chamberFan = 0;
+  uint8_t heatbreakFan = 0;
+  Tray trays[MAX_AMS * TRAYS_PER_AMS];
+};
+
+#endif // PRINTERSTATE_H
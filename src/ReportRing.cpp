@@ -0,0 +1,116 @@
+#include "ReportRing.h"
+
+bool ReportRing::claim(uint8_t slot, uint8_t from, uint8_t to) {
+  return __atomic_compare_exchange_n(&slots[slot].state, &from, to, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+// Only looks at reports committed before it started. Ones committed while it is looking could
+// be older than others it has already seen, if their slot was looked at before they were ready.
+int8_t ReportRing::findOldestReady(uint32_t& sequence) const {
+  uint32_t limit = __atomic_load_n(&nextSequence, __ATOMIC_ACQUIRE);
+  int8_t oldest = -1;
+  for (uint8_t i=0; i < NUM_SLOTS; i++) {
+    if (__atomic_load_n(&slots[i].state, __ATOMIC_ACQUIRE) != ready) {
+      continue;
+    }
+
+    // The writer may be reusing the slot, so this may already be a later report's sequence
+    uint32_t slotSequence = __atomic_load_n(&slots[i].sequence, __ATOMIC_RELAXED);
+    if ((int32_t)(slotSequence - limit) < 0 && (oldest < 0 || (int32_t)(slotSequence - sequence) < 0)) {
+      oldest = i;
+      sequence = slotSequence;
+    }
+  }
+  return oldest;
+}
+
+char* ReportRing::beginWrite() {
+  if (writeSlot >= 0) {
+    return slots[writeSlot].data;
+  }
+
+  while (true) {
+    for (uint8_t i=0; i < NUM_SLOTS; i++) {
+      if (claim(i, empty, writing)) {
+        writeSlot = i;
+        return slots[i].data;
+      }
+    }
+
+    // Full. The reader may take the oldest first, in which case look again
+    uint32_t sequence;
+    int8_t oldest = findOldestReady(sequence);
+    if (oldest >= 0 && claim(oldest, ready, writing)) {
+      dropped++;
+      writeSlot = oldest;
+      return slots[oldest].data;
+    }
+  }
+}
+
+void ReportRing::commit(size_t length, uint32_t receivedMicros) {
+  if (writeSlot < 0) {
+    return;
+  }
+
+  Slot& slot = slots[writeSlot];
+  slot.length = length;
+  slot.receivedMicros = receivedMicros;
+  __atomic_store_n(&slot.sequence, nextSequence, __ATOMIC_RELAXED);
+  __atomic_store_n(&slot.state, (uint8_t)ready, __ATOMIC_RELEASE);
+  __atomic_store_n(&nextSequence, nextSequence + 1, __ATOMIC_RELEASE);
+  writeSlot = -1;
+
+  uint8_t depth = getDepth();
+  if (depth > maxDepth) {
+    maxDepth = depth;
+  }
+}
+
+void ReportRing::abort() {
+  if (writeSlot >= 0) {
+    __atomic_store_n(&slots[writeSlot].state, (uint8_t)empty, __ATOMIC_RELEASE);
+    writeSlot = -1;
+  }
+}
+
+const char* ReportRing::beginRead(size_t& length, uint32_t& receivedMicros) {
+  while (readSlot < 0) {
+    uint32_t sequence;
+    int8_t oldest = findOldestReady(sequence);
+    if (oldest < 0) {
+      return 0;
+    }
+
+    // The writer may have just taken it to drop it, in which case look again. It may even
+    // have put a newer report in it since, in which case put that back and look again.
+    if (claim(oldest, ready, reading)) {
+      if (__atomic_load_n(&slots[oldest].sequence, __ATOMIC_RELAXED) == sequence) {
+        readSlot = oldest;
+      } else {
+        __atomic_store_n(&slots[oldest].state, (uint8_t)ready, __ATOMIC_RELEASE);
+      }
+    }
+  }
+
+  length = slots[readSlot].length;
+  receivedMicros = slots[readSlot].receivedMicros;
+  return slots[readSlot].data;
+}
+
+void ReportRing::endRead() {
+  if (readSlot >= 0) {
+    __atomic_store_n(&slots[readSlot].state, (uint8_t)empty, __ATOMIC_RELEASE);
+    readSlot = -1;
+  }
+}
+
+uint8_t ReportRing::getDepth() const {
+  uint8_t depth = 0;
+  for (uint8_t i=0; i < NUM_SLOTS; i++) {
+    if (__atomic_load_n(&slots[i].state, __ATOMIC_RELAXED) == ready) {
+      depth++;
+    }
+  }
+  return depth;
+}
@@ -0,0 +1,63 @@
+#ifndef REPORTRING_H
+#define REPORTRING_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Hands filtered printer reports from the MQTT client's task, which
+ * writes them, to the parse task, which reads them. Neither side ever
+ * waits for the other, and a report is written straight into the slot
+ * it is read from.
+ *
+ * Each slot is claimed by flipping its state with a compare-and-swap.
+ * The writer holds at most one slot and the reader at most one, so the
+ * writer always finds one: an empty one if there is one, otherwise the
+ * oldest report still waiting, which is dropped so the newest is kept.
+ * The reader takes waiting reports oldest first.
+ */
+class ReportRing {
+public:
+  static const uint8_t NUM_SLOTS = 4;
+  static const size_t SLOT_SIZE = 1536;
+
+  // Writer side. beginWrite() returns the slot the report goes in, the same one again if
+  // the last report was never committed
+  char* beginWrite();
+  void commit(size_t length, uint32_t receivedMicros);
+  void abort();
+
+  // Reader side. beginRead() returns the oldest waiting report, or 0 if there isn't one,
+  // which stays valid until endRead()
+  const char* beginRead(size_t& length, uint32_t& receivedMicros);
+  void endRead();
+
+  // Reports waiting to be read
+  uint8_t getDepth() const;
+  uint8_t getMaxDepth() const { return maxDepth; }
+  // Waiting reports dropped to make room for newer ones
+  uint32_t getDropped() const { return dropped; }
+
+private:
+  enum SlotState : uint8_t { empty, writing, ready, reading };
+
+  struct Slot {
+    uint8_t state = empty;
+    uint32_t sequence = 0;
+    size_t length = 0;
+    uint32_t receivedMicros = 0;
+    char data[SLOT_SIZE];
+  };
+
+  Slot slots[NUM_SLOTS];
+  int8_t writeSlot = -1;
+  int8_t readSlot = -1;
+  uint32_t nextSequence = 0;
+  uint8_t maxDepth = 0;
+  uint32_t dropped = 0;
+
+  bool claim(uint8_t slot, uint8_t from, uint8_t to);
+  int8_t findOldestReady(uint32_t& sequence) const;
+};
+
+#endif // REPORTRING_H
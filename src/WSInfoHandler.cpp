@@ -39,6 +39,7 @@ void WSInfoHandler::handle(AsyncWebSocketClient *client, char *data) {
 	value["esp_free_iram_heap"] = heap_caps_get_free_size(MALLOC_CAP_IRAM_8BIT | MALLOC_CAP_32BIT);
 	value["esp_free_heap"] = ESP.getFreeHeap();
 	value["esp_free_heap_min"] = ESP.getMinFreeHeap();
+	value["esp_boot_heap"] = bootHeap;
 	value["esp_max_alloc_heap"] = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
 	value["esp_sketch_size"] = sketchSize(SKETCH_SIZE_TOTAL);
 	value["esp_sketch_space"] = sketchSize(SKETCH_SIZE_FREE);
@@ -57,6 +58,25 @@ void WSInfoHandler::handle(AsyncWebSocketClient *client, char *data) {
 	value["brightness"] = brightness;
 	value["triggered"] = triggered;
 	value["clock_on"] = clockOn;
+	value["led_loop_max"] = ledLoopMax;
+	value["led_last_fade"] = ledLastFade;
+	value["led_frames"] = ledFrames;
+	value["led_output"] = ledOutput;
+	value["led_resize"] = ledResize;
+	value["led_power"] = ledPower;
+	value["led_hsv"] = ledHsv;
+	value["led_render"] = ledRender;
+	value["led_show"] = ledShow;
+	value["led_period"] = ledPeriod;
+	value["led_latency"] = ledLatency;
+	value["led_stats"] = serialized(ledStats);
+	value["mqtt_reports"] = mqttReports;
+	value["mqtt_filter"] = mqttFilter;
+	value["mqtt_parse"] = mqttParse;
+	value["mqtt_queue"] = mqttQueue;
+	value["printer"] = printer;
+	value["printer_ams"] = printerAms;
+	value["printer_latency"] = printerLatency;
 
 	// value["up_time"] = uptime.uptime();
 	value["sync_time"] = lastUpdateTime;
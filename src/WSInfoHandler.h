@@ -62,6 +62,87 @@ public:
 		this->revision = revision;
 	}
 
+	void setLedLoopMax(const String& ledLoopMax) {
+		this->ledLoopMax = ledLoopMax;
+	}
+
+	void setLedLastFade(const String& ledLastFade) {
+		this->ledLastFade = ledLastFade;
+	}
+
+	void setLedFrames(const String& ledFrames) {
+		this->ledFrames = ledFrames;
+	}
+
+	void setLedOutput(const String& ledOutput) {
+		this->ledOutput = ledOutput;
+	}
+
+	void setLedResize(const String& ledResize) {
+		this->ledResize = ledResize;
+	}
+
+	void setLedPower(const String& ledPower) {
+		this->ledPower = ledPower;
+	}
+
+	void setLedHsv(const String& ledHsv) {
+		this->ledHsv = ledHsv;
+	}
+
+	void setLedRender(const String& ledRender) {
+		this->ledRender = ledRender;
+	}
+
+	void setLedShow(const String& ledShow) {
+		this->ledShow = ledShow;
+	}
+
+	void setLedPeriod(const String& ledPeriod) {
+		this->ledPeriod = ledPeriod;
+	}
+
+	void setLedLatency(const String& ledLatency) {
+		this->ledLatency = ledLatency;
+	}
+
+	// Already JSON, sent as is for anything that wants the raw histograms
+	void setLedStats(const String& ledStats) {
+		this->ledStats = ledStats;
+	}
+
+	void setBootHeap(const String& bootHeap) {
+		this->bootHeap = bootHeap;
+	}
+
+	void setMqttReports(const String& mqttReports) {
+		this->mqttReports = mqttReports;
+	}
+
+	void setMqttFilter(const String& mqttFilter) {
+		this->mqttFilter = mqttFilter;
+	}
+
+	void setMqttQueue(const String& mqttQueue) {
+		this->mqttQueue = mqttQueue;
+	}
+
+	void setMqttParse(const String& mqttParse) {
+		this->mqttParse = mqttParse;
+	}
+
+	void setPrinterLatency(const String& printerLatency) {
+		this->printerLatency = printerLatency;
+	}
+
+	void setPrinter(const String& printer) {
+		this->printer = printer;
+	}
+
+	void setPrinterAms(const String& printerAms) {
+		this->printerAms = printerAms;
+	}
+
 private:
 	CbFunc cbFunc;
 
@@ -77,6 +158,26 @@ private:
 	String failedCount;
 	String hostname;
 	String revision;
+	String ledLoopMax;
+	String ledLastFade;
+	String ledFrames;
+	String ledOutput;
+	String ledResize;
+	String ledPower;
+	String ledHsv;
+	String ledRender;
+	String ledShow;
+	String ledPeriod;
+	String ledLatency;
+	String ledStats;
+	String bootHeap;
+	String mqttReports;
+	String mqttFilter;
+	String mqttParse;
+	String mqttQueue;
+	String printer;
+	String printerAms;
+	String printerLatency;
 };
 
 
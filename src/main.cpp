@@ -20,7 +20,9 @@
 #include "WSLEDConfigHandler.h"
 #include "WSInfoHandler.h"
 #include "MQTTBroker.h"
+#include "HmsDatabase.h"
 #include "MQTTHABroker.h"
+#include "MessagePool.h"
 #include "BambuLights.h"
 
 #define DEBUG(...) { Serial.println(__VA_ARGS__); }
@@ -67,10 +69,25 @@ BambuLights *bambuLights;
 
 SemaphoreHandle_t wsMutex;
 
+// What static initialization left us, before setup() allocates anything
+uint32_t bootFreeHeap;
+
+// From a printer report arriving to the end of the first frame drawn after it
+LatencyHistogram printerLatencies;
+
+// CPU cycles to convert one color, measured on this chip at boot: hsvToRgb() and the HsbColor conversion it replaced
+uint32_t hsvCycles;
+uint32_t hsbColorCycles;
+
 TaskHandle_t wifiManagerTask;
 TaskHandle_t improvTask;
 TaskHandle_t ledTask;
 TaskHandle_t commitEEPROMTask;
+TaskHandle_t parseTask;
+
+// The printer fields the LED task uses, and so the ones that wake it up
+const uint32_t LIGHTS_FIELDS = PrinterState::CONNECTION | PrinterState::STATE | PrinterState::DOOR
+	| PrinterState::CHAMBER_LIGHT | PrinterState::PROGRESS;
 
 String ssid = "BambuLights";
 
@@ -187,10 +204,23 @@ void onChamberSyncChanged(ConfigItem<boolean> &chamberSync) {
 	}
 }
 
-void onNumLedsChanged(ConfigItem<byte> &item) {
+void onNumLedsChanged(ConfigItem<int> &item) {
+	bambuLights->updatePixelCount();
+}
+
+void onLedPinsChanged(ConfigItem<String> &item) {
 	bambuLights->updatePixelCount();
 }
 
+template<class T>
+void onCorrectionChanged(ConfigItem<T> &item) {
+	bambuLights->updateCorrection();
+}
+
+void onMaxMilliampsChanged(ConfigItem<int> &item) {
+	bambuLights->updatePowerLimit();
+}
+
 template<class T>
 void onMqttParamsChanged(ConfigItem<T> &item) {
 	mqttBroker.init(ssid);
@@ -207,6 +237,11 @@ void onHostnameChanged(ConfigItem<T> &item) {
 	ESP.restart();
 }
 
+// Printer reports are parsed here rather than on the MQTT client's own task, so a slow one doesn't hold that up
+void parseTaskFn(void *pArg) {
+	mqttBroker.runParser();
+}
+
 void ledTaskFn(void *pArg) {
 	bambuLights->begin();
 	BambuLights::State prevLightsState = BambuLights::noWiFi;
@@ -215,17 +250,25 @@ void ledTaskFn(void *pArg) {
 	bool doorWasOpen = false;
 	bool chamberLightWasOn = true;
 
+	// The latest the broker has sent us, which it doesn't touch once it is sent
+	MQTTBroker::Snapshot snapshot;
+
 	while (true) {
 		mqttBroker.checkConnection();
 		mqttHABroker.checkConnection();
 
-		bambuLights->setBrightness(255);	// Brightness scale factor
+		uint32_t changed = 0;
+		uint32_t receivedMicros = 0;
+		if (mqttBroker.receiveSnapshot(snapshot)) {
+			changed = snapshot.changed;
+			receivedMicros = snapshot.receivedMicros;
+		}
 
 		BambuLights::State lightsState = BambuLights::noWiFi;
 
 		if (WiFi.isConnected()) {		
 			// Run the state machine
-			switch (mqttBroker.getState()) {
+			switch (snapshot.state) {
 				case MQTTBroker::disconnected:
 					lightsState = BambuLights::noPrinter;
 					break;
@@ -249,7 +292,7 @@ void ledTaskFn(void *pArg) {
 							}
 
 							// Switch to normal idle lights if door is opened after print complete
-							if (!doorWasOpen && mqttBroker.isDoorOpen()) {
+							if (!doorWasOpen && snapshot.printer.doorOpen) {
 								lightsState = BambuLights::printer;
 								inFinishedPhase = false;
 							}
@@ -271,13 +314,12 @@ void ledTaskFn(void *pArg) {
 			}
 
 			prevLightsState = lightsState;
-			doorWasOpen = mqttBroker.isDoorOpen();
+			doorWasOpen = snapshot.printer.doorOpen;
 
-			boolean chamberLightIsOn = mqttBroker.isLightOn();
-            if (chamberLightIsOn != chamberLightWasOn) {
-				chamberLightWasOn = chamberLightIsOn;
-				if (BambuLights::getChamberSync() && (BambuLights::getLightState() != chamberLightIsOn)) {
-					BambuLights::getLightState() = chamberLightIsOn;
+            if (snapshot.printer.lightOn != chamberLightWasOn) {
+				chamberLightWasOn = snapshot.printer.lightOn;
+				if (BambuLights::getChamberSync() && (BambuLights::getLightState() != chamberLightWasOn)) {
+					BambuLights::getLightState() = chamberLightWasOn;
 					BambuLights::getLightState().notify();
 					broadcastUpdate(BambuLights::getLightState().name, BambuLights::getLightState());
 				}
@@ -294,10 +336,16 @@ void ledTaskFn(void *pArg) {
 		}
 
 		bambuLights->setState(lightsState);
+		if (changed & PrinterState::PROGRESS) {
+			bambuLights->setProgress(snapshot.printer.percent);
+		}
 
 		bambuLights->loop();
+		if (receivedMicros) {
+			printerLatencies.add(micros() - receivedMicros);
+		}
 
-		delay(16);
+		bambuLights->waitForNextFrame();
 	}
 }
 
@@ -354,14 +402,122 @@ WSHandler* wsHandlers[] {
 };
 
 
+String describePrinter(const PrinterState& printer) {
+	if (!printer.connected) {
+		return "Not connected";
+	}
+
+	return String(printer.gcodeState) + ", " + MQTTBroker::getStageName(printer.stage)
+		+ ", " + String(printer.percent) + "% layer " + String(printer.layer) + "/" + String(printer.totalLayers)
+		+ ", " + String(printer.remainingMinutes) + " min left"
+		+ ", nozzle " + String(printer.nozzleTemp, 0) + "/" + String(printer.nozzleTarget, 0)
+		+ "C, bed " + String(printer.bedTemp, 0) + "/" + String(printer.bedTarget, 0)
+		+ "C, chamber " + String(printer.chamberTemp, 0)
+		+ "C, fans " + String(printer.partFan) + "/" + String(printer.auxFan) + "/" + String(printer.chamberFan) + "/" + String(printer.heatbreakFan);
+}
+
+// Loaded trays as slot (A1 is the first slot of the first AMS), color and how much is left
+String describeAms(const PrinterState& printer) {
+	String ams;
+	for (int i=0; i < PrinterState::MAX_AMS * PrinterState::TRAYS_PER_AMS; i++) {
+		const PrinterState::Tray& tray = printer.trays[i];
+		if (tray.color == 0) {
+			continue;
+		}
+
+		char buf[24];
+		sprintf(buf, "%s%c%d #%06X", ams.length() ? ", " : "", 'A' + i / PrinterState::TRAYS_PER_AMS, i % PrinterState::TRAYS_PER_AMS + 1, tray.color >> 8);
+		ams += buf;
+		if (tray.remain >= 0) {
+			ams += " " + String(tray.remain) + "%";
+		}
+	}
+
+	return ams.length() ? ams : "None";
+}
+
+// What fill() and setPixelColor() used to do. Out of line, as hsvToRgb() is, so the two are timed alike.
+__attribute__((noinline)) static RgbColor hsbColorToRgb(uint8_t hue, uint8_t sat, uint8_t val) {
+	return HsbColor(hue/256.0, sat/256.0, val/256.0);
+}
+
+// A fade's worth of colors through each conversion. Done before the other tasks start, so nothing interrupts it much.
+void measureHsvConversion() {
+	static const int COLORS = 256;
+	volatile uint8_t sink = 0;	// So the conversions aren't optimized away
+
+	uint32_t start = ESP.getCycleCount();
+	for (int i=0; i < COLORS; i++) {
+		RgbColor color = hsvToRgb(i, 200, 255 - i);
+		sink += color.R + color.G + color.B;
+	}
+	hsvCycles = (ESP.getCycleCount() - start) / COLORS;
+
+	start = ESP.getCycleCount();
+	for (int i=0; i < COLORS; i++) {
+		RgbColor color = hsbColorToRgb(i, 200, 255 - i);
+		sink += color.R + color.G + color.B;
+	}
+	hsbColorCycles = (ESP.getCycleCount() - start) / COLORS;
+
+	Serial.printf("HSV to RGB: %u cycles per color, %u with HsbColor\n", hsvCycles, hsbColorCycles);
+}
+
 void infoCallback() {
 	wsInfoHandler.setSsid(ssid);
 	wsInfoHandler.setRevision(manifest[1]);
 
+	wsInfoHandler.setBootHeap(String(bootFreeHeap));
 	wsInfoHandler.setFSSize(String(LittleFS.totalBytes()));
 	wsInfoHandler.setFSFree(String(LittleFS.totalBytes() - LittleFS.usedBytes()));
 
 	wsInfoHandler.setHostname(hostName);
+
+	wsInfoHandler.setLedLoopMax(String(bambuLights->getMaxLoopMicros()));
+	wsInfoHandler.setLedLastFade(String(bambuLights->getLastFadeFrames()) + " frames in " + String(bambuLights->getLastFadeMillis()) + "ms");
+	wsInfoHandler.setLedFrames(String(bambuLights->getFramesShown()) + " shown, " + String(bambuLights->getLateFrames()) + " late, " + String(bambuLights->getDroppedFrames()) + " dropped");
+	String ledOutput = String(bambuLights->getNumOutputs()) + " pins, " + String(bambuLights->getLongestOutput()) + " LEDs on the longest, ~" + String(bambuLights->getExpectedFrameMicros()) + "us/frame, room for " + String(bambuLights->getLEDCapacity());
+	if (bambuLights->getLiveFrameMicros() != bambuLights->getExpectedFrameMicros()) {
+		// The reserved room is sent too, so say what the LEDs in use alone would take
+		ledOutput += " (~" + String(bambuLights->getLiveFrameMicros()) + "us without it)";
+	}
+	wsInfoHandler.setLedOutput(ledOutput);
+	wsInfoHandler.setLedPower("~" + String(bambuLights->getEstimatedMilliamps()) + "mA, scaled to " + String(bambuLights->getPowerScale() * 100 / 256) + "%");
+	wsInfoHandler.setLedHsv(String(hsvCycles) + " cycles per color, " + String(hsbColorCycles) + " with HsbColor");
+	wsInfoHandler.setLedRender(bambuLights->getRenderTimes().toString());
+	wsInfoHandler.setLedShow(bambuLights->getShowTimes().toString());
+	wsInfoHandler.setLedPeriod(bambuLights->getLoopPeriods().toString());
+	wsInfoHandler.setLedLatency(bambuLights->getChangeLatencies().toString());
+	wsInfoHandler.setPrinterLatency(printerLatencies.toString());
+	wsInfoHandler.setLedStats("{\"render\":" + bambuLights->getRenderTimes().toJson()
+		+ ",\"show\":" + bambuLights->getShowTimes().toJson()
+		+ ",\"period\":" + bambuLights->getLoopPeriods().toJson()
+		+ ",\"latency\":" + bambuLights->getChangeLatencies().toJson()
+		+ ",\"printer\":" + printerLatencies.toJson() + "}");
+	wsInfoHandler.setMqttReports(String(mqttBroker.getReportCount()) + " (" + String(mqttBroker.getDroppedReports()) + " dropped, " + String(mqttBroker.getSkippedReports()) + " skipped), largest " + String(mqttBroker.getLargestReport()) + " bytes filtered to " + String(mqttBroker.getLargestFiltered()) + ", " + String(mqttBroker.getStateChanges()) + " with changes");
+	wsInfoHandler.setMqttFilter(mqttBroker.getFilterTimes().toString());
+	wsInfoHandler.setMqttQueue(String(mqttBroker.getQueueDepth()) + " waiting (at most " + String(mqttBroker.getMaxQueueDepth()) + " of " + String(ReportRing::NUM_SLOTS) + "), "
+		+ String(mqttBroker.getOverwrittenReports()) + " overwritten, " + String(mqttBroker.getCoalescedReports()) + " coalesced, "
+		+ String(MessagePool::getExhausted()) + " fragmented HA messages dropped for want of a buffer");
+	// Only rebuilt when something they show has changed
+	static String printer;
+	static String ams;
+	uint32_t changed = mqttBroker.takeChanges(MQTTBroker::web);
+	if (changed) {
+		// A copy, as the parse task may be updating the state while we read it
+		static MQTTBroker::Snapshot snapshot;
+		mqttBroker.getSnapshot(snapshot);
+		if (changed & ~PrinterState::AMS) {
+			printer = describePrinter(snapshot.printer);
+		}
+		if (changed & (PrinterState::CONNECTION | PrinterState::AMS)) {
+			ams = describeAms(snapshot.printer);
+		}
+	}
+	wsInfoHandler.setPrinter(printer);
+	wsInfoHandler.setPrinterAms(ams);
+	wsInfoHandler.setMqttParse(mqttBroker.getParseTimes().toString() + ", peak " + String(mqttBroker.getParsePeakBytes()) + " bytes, " + String(mqttBroker.getParseAllocations()) + " allocations last time");
+	wsInfoHandler.setLedResize("Largest free block " + String(bambuLights->getLargestFreeBeforeResize()) + " before, " + String(bambuLights->getLargestFreeAfterResize()) + " after");
 }
 
 void broadcastUpdate(String originalKey, String& originalValue) {
@@ -402,6 +558,7 @@ void updateValue(String originalKey, String _key, String value, BaseConfigItem *
 			// Order of below is important to maintain external consistency
 			broadcastUpdate(originalKey, *item);
 			item->notify();
+			bambuLights->wake();
 		} else if (_key == "wifi_ap") {
 			setWiFiAP(value == TRUE_STRING ? true : false);
 		}
@@ -539,6 +696,9 @@ void initFromEEPROM() {
 	DEBUG(hostName);
 	rootConfig.get();	// Read all of the config values from EEPROM
 	DEBUG(hostName);
+	if (BambuLights::migrateConfig()) {
+		config.commit();
+	}
 
 	hostnameParam = new AsyncWiFiManagerParameter("Hostname", "device host name", hostName.value.c_str(), 63);
 }
@@ -579,9 +739,15 @@ void setup()
 	/*
 	 * setup() runs on core 1
 	 */
+	bootFreeHeap = ESP.getFreeHeap();
+
   Serial.begin(115200);
   Serial.setDebugOutput(true);
 
+	Serial.printf("Free heap at boot: %u, HMS database %s: %u codes in %u bytes of flash\n", bootFreeHeap, HmsDatabase::getVersion(), HmsDatabase::getCount(), HmsDatabase::getFlashBytes());
+
+	measureHsvConversion();
+
 	wsMutex = xSemaphoreCreateMutex();
 
 	createSSID();
@@ -616,6 +782,19 @@ void setup()
 #endif
 	);
 
+	// Before the broker can connect, so the LED task hears about the very first report
+	mqttBroker.setNotifyTask(ledTask, LIGHTS_FIELDS);
+
+  xTaskCreatePinnedToCore(
+		parseTaskFn, /* Function to implement the task */
+		"Parse task", /* Name of the task */
+		4096,  /* Stack size in words */
+		NULL,  /* Task input parameter */
+		tskIDLE_PRIORITY + 1,  /* Below the MQTT client and the LEDs */
+		&parseTask,  /* Task handle. */
+		0
+	);
+
   xTaskCreatePinnedToCore(
 		improvTaskFn, /* Function to implement the task */
 		"Improv task", /* Name of the task */
@@ -664,6 +843,13 @@ void setup()
 	hostName.setCallback(onHostnameChanged);
 	BambuLights::getLedType().setCallback(onLedTypeChanged);
 	BambuLights::getNumLEDs().setCallback(onNumLedsChanged);
+	BambuLights::getLedPins().setCallback(onLedPinsChanged);
+	BambuLights::getGamma().setCallback(onCorrectionChanged);
+	BambuLights::getRedBalance().setCallback(onCorrectionChanged);
+	BambuLights::getGreenBalance().setCallback(onCorrectionChanged);
+	BambuLights::getBlueBalance().setCallback(onCorrectionChanged);
+	BambuLights::getDithering().setCallback(onCorrectionChanged);
+	BambuLights::getMaxMilliamps().setCallback(onMaxMilliampsChanged);
 	BambuLights::getLightMode().setCallback(onLightModeChanged);
 	BambuLights::getLightState().setCallback(onLightStateChanged);
 	BambuLights::getChamberSync().setCallback(onChamberSyncChanged);
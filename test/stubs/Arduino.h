@@ -0,0 +1,98 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+/*
+ * Just enough of the Arduino core to build the lights and the report
+ * handling on the host, for the tests in test/. Time only passes when a test
+ * says so: millis() and micros() read a clock that advanceMillis() and
+ * advanceMicros() move, so every run animates exactly the same way.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+#include "HostClock.h"
+#include "freertos/FreeRTOS.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+using std::min;
+using std::max;
+
+#define F(string_literal) (string_literal)
+
+// The ESP32's newlib has it, glibc only from 2.38
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+inline size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t length = strlen(src);
+  if (size > 0) {
+    size_t n = length < size - 1 ? length : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = 0;
+  }
+  return length;
+}
+#endif
+
+class String : public std::string {
+public:
+  String() {}
+  String(const char *s) : std::string(s ? s : "") {}
+  String(const std::string& s) : std::string(s) {}
+  explicit String(char c) : std::string(1, c) {}
+  explicit String(unsigned char value) : std::string(std::to_string(value)) {}
+  explicit String(int value) : std::string(std::to_string(value)) {}
+  explicit String(unsigned int value) : std::string(std::to_string(value)) {}
+  explicit String(long value) : std::string(std::to_string(value)) {}
+  explicit String(unsigned long value) : std::string(std::to_string(value)) {}
+  explicit String(long long value) : std::string(std::to_string(value)) {}
+  explicit String(unsigned long long value) : std::string(std::to_string(value)) {}
+  explicit String(double value, unsigned char decimals = 2) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+    assign(buf);
+  }
+
+  bool concat(const String& s) { append(s); return true; }
+  bool concat(const char *s) { append(s); return true; }
+  bool concat(char c) { push_back(c); return true; }
+
+  long toInt() const { return atol(c_str()); }
+  int indexOf(char c, unsigned int from = 0) const { size_t i = find(c, from); return i == npos ? -1 : (int)i; }
+  String substring(unsigned int from) const { return from < length() ? String(substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const { return from < to && from < length() ? String(substr(from, to - from)) : String(); }
+};
+
+// 32 bits, as on the ESP32, so wraparound arithmetic behaves the same
+inline uint32_t micros() { return hostMicros(); }
+inline uint32_t millis() { return hostMicros() / 1000; }
+inline void delay(uint32_t ms) { advanceMillis(ms); }
+
+/*
+ * Swallows whatever is printed, so debug output doesn't drown the test
+ * results. write() is there so ArduinoJson can serialize to it.
+ */
+class HostSerial {
+public:
+  void begin(unsigned long) {}
+  template <class T> size_t print(const T&) { return 0; }
+  template <class T> size_t print(const T&, int) { return 0; }
+  template <class T> size_t println(const T&) { return 0; }
+  template <class T> size_t println(const T&, int) { return 0; }
+  size_t println() { return 0; }
+  template <class... Args> size_t printf(const char *, const Args&...) { return 0; }
+  size_t write(uint8_t) { return 1; }
+  size_t write(const uint8_t *, size_t size) { return size; }
+  void flush() {}
+};
+
+static HostSerial Serial __attribute__((unused));
+
+#endif // HOST_ARDUINO_H
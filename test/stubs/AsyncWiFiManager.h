@@ -0,0 +1,12 @@
+#ifndef HOST_ASYNCWIFIMANAGER_H
+#define HOST_ASYNCWIFIMANAGER_H
+
+class AsyncWiFiManager {
+public:
+  bool isAP() { return false; }
+};
+
+// main.cpp owns it on the ESP32. Weak, so a test can still define its own.
+__attribute__((weak)) AsyncWiFiManager wifiManager;
+
+#endif // HOST_ASYNCWIFIMANAGER_H
@@ -0,0 +1,82 @@
+#ifndef HOST_CONFIGITEM_H
+#define HOST_CONFIGITEM_H
+
+/*
+ * The Configs library's items without the storage behind them: they hold
+ * their values, find each other by name and call their callbacks, but put()
+ * and get() don't go anywhere. Tests set a value by assigning to the item.
+ */
+
+#include <Arduino.h>
+
+class BaseConfigItem {
+public:
+  BaseConfigItem(const char *name, int maxSize) : name(name), maxSize(maxSize) {}
+  virtual ~BaseConfigItem() {}
+
+  // The child item called name, for items that have children
+  virtual BaseConfigItem* get(const char *) { return 0; }
+  virtual void get() {}
+  virtual void put() {}
+  virtual void notify() {}
+
+  const char *name;
+  int maxSize;
+};
+
+template <class T>
+class ConfigItem : public BaseConfigItem {
+public:
+  ConfigItem(const char *name, int maxSize, const T& value) : BaseConfigItem(name, maxSize), value(value), callback(0) {}
+
+  operator T () const { return value; }
+  ConfigItem& operator=(const T& value) { this->value = value; return *this; }
+
+  void setCallback(void (*callback)(ConfigItem<T>&)) { this->callback = callback; }
+  virtual void notify() { if (callback) callback(*this); }
+
+  T value;
+
+private:
+  void (*callback)(ConfigItem<T>&);
+};
+
+class ByteConfigItem : public ConfigItem<byte> {
+public:
+  ByteConfigItem(const char *name, byte value) : ConfigItem<byte>(name, 1, value) {}
+  using ConfigItem<byte>::operator=;
+};
+
+class IntConfigItem : public ConfigItem<int> {
+public:
+  IntConfigItem(const char *name, int value) : ConfigItem<int>(name, sizeof(int), value) {}
+  using ConfigItem<int>::operator=;
+};
+
+class BooleanConfigItem : public ConfigItem<boolean> {
+public:
+  BooleanConfigItem(const char *name, boolean value) : ConfigItem<boolean>(name, 1, value) {}
+  using ConfigItem<boolean>::operator=;
+};
+
+class StringConfigItem : public ConfigItem<String> {
+public:
+  StringConfigItem(const char *name, byte maxSize, const String& value) : ConfigItem<String>(name, maxSize, value) {}
+  using ConfigItem<String>::operator=;
+};
+
+class CompositeConfigItem : public ConfigItem<BaseConfigItem**> {
+public:
+  CompositeConfigItem(const char *name, int maxSize, BaseConfigItem** items) : ConfigItem<BaseConfigItem**>(name, maxSize, items) {}
+
+  virtual BaseConfigItem* get(const char *name) {
+    for (BaseConfigItem **item = value; *item; item++) {
+      if (strcmp((*item)->name, name) == 0) {
+        return *item;
+      }
+    }
+    return 0;
+  }
+};
+
+#endif // HOST_CONFIGITEM_H
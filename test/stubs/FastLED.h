@@ -0,0 +1,71 @@
+#ifndef HOST_FASTLED_H
+#define HOST_FASTLED_H
+
+/*
+ * CHSV and the CHSV blend() from FastLED, with the same integer math, which
+ * is all the lights use from it.
+ */
+
+#include <stdint.h>
+
+typedef uint8_t fract8;
+
+enum TGradientDirectionCode { FORWARD_HUES, BACKWARD_HUES, SHORTEST_HUES, LONGEST_HUES };
+
+struct CHSV {
+  union {
+    struct {
+      union { uint8_t hue; uint8_t h; };
+      union { uint8_t saturation; uint8_t sat; uint8_t s; };
+      union { uint8_t value; uint8_t val; uint8_t v; };
+    };
+    uint8_t raw[3];
+  };
+
+  CHSV() {}
+  CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+inline uint8_t scale8(uint8_t i, fract8 scale) {
+  return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8;
+}
+
+inline CHSV& nblend(CHSV& existing, const CHSV& overlay, fract8 amountOfOverlay, TGradientDirectionCode directionCode) {
+  if (amountOfOverlay == 0) {
+    return existing;
+  }
+  if (amountOfOverlay == 255) {
+    existing = overlay;
+    return existing;
+  }
+
+  fract8 amountOfKeep = 255 - amountOfOverlay;
+  uint8_t huedelta8 = overlay.hue - existing.hue;
+
+  if (directionCode == SHORTEST_HUES) {
+    directionCode = huedelta8 > 127 ? BACKWARD_HUES : FORWARD_HUES;
+  }
+  if (directionCode == LONGEST_HUES) {
+    directionCode = huedelta8 < 128 ? BACKWARD_HUES : FORWARD_HUES;
+  }
+
+  if (directionCode == FORWARD_HUES) {
+    existing.hue = existing.hue + scale8(huedelta8, amountOfOverlay);
+  } else {
+    huedelta8 = -huedelta8;
+    existing.hue = existing.hue - scale8(huedelta8, amountOfOverlay);
+  }
+
+  existing.sat = scale8(existing.sat, amountOfKeep) + scale8(overlay.sat, amountOfOverlay);
+  existing.val = scale8(existing.val, amountOfKeep) + scale8(overlay.val, amountOfOverlay);
+
+  return existing;
+}
+
+inline CHSV blend(const CHSV& p1, const CHSV& p2, fract8 amountOfP2, TGradientDirectionCode directionCode = SHORTEST_HUES) {
+  CHSV ret(p1);
+  nblend(ret, p2, amountOfP2, directionCode);
+  return ret;
+}
+
+#endif // HOST_FASTLED_H
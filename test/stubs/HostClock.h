@@ -0,0 +1,38 @@
+#ifndef HOST_CLOCK_H
+#define HOST_CLOCK_H
+
+#include <stdint.h>
+#include <functional>
+#include <map>
+
+// The clock behind millis(), micros() and the FreeRTOS tick count. Only the tests move it.
+inline uint32_t& hostMicros() { static uint32_t now = 0; return now; }
+
+// Things set to happen at a given time, as another task or the network would make them happen
+inline std::multimap<uint32_t, std::function<void()> >& hostEvents() { static std::multimap<uint32_t, std::function<void()> > events; return events; }
+inline void atMicros(uint32_t when, std::function<void()> event) { hostEvents().insert(std::make_pair(when, event)); }
+
+// Moves the clock on to until, stopping to run any events due on the way. If stop says so after
+// one of them, the clock is left where that event happened instead.
+inline void runUntil(uint32_t until, std::function<bool()> stop = std::function<bool()>()) {
+  std::multimap<uint32_t, std::function<void()> >& events = hostEvents();
+  while (!events.empty() && events.begin()->first <= until) {
+    if (events.begin()->first > hostMicros()) {
+      hostMicros() = events.begin()->first;
+    }
+    std::function<void()> event = events.begin()->second;
+    events.erase(events.begin());
+    event();
+    if (stop && stop()) {
+      return;
+    }
+  }
+  if (until > hostMicros()) {
+    hostMicros() = until;
+  }
+}
+
+inline void advanceMicros(uint32_t micros) { runUntil(hostMicros() + micros); }
+inline void advanceMillis(uint32_t millis) { advanceMicros(millis * 1000); }
+
+#endif // HOST_CLOCK_H
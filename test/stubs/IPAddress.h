@@ -0,0 +1,28 @@
+#ifndef HOST_IPADDRESS_H
+#define HOST_IPADDRESS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+class IPAddress {
+public:
+  bool fromString(const char *address) {
+    unsigned a, b, c, d;
+    char extra;
+    if (sscanf(address, "%u.%u.%u.%u%c", &a, &b, &c, &d, &extra) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+      return false;
+    }
+    bytes[0] = a;
+    bytes[1] = b;
+    bytes[2] = c;
+    bytes[3] = d;
+    return true;
+  }
+
+  uint8_t operator[](int index) const { return bytes[index]; }
+
+private:
+  uint8_t bytes[4] = { 0, 0, 0, 0 };
+};
+
+#endif // HOST_IPADDRESS_H
@@ -0,0 +1,226 @@
+#ifndef HOST_NEOPIXELBUS_H
+#define HOST_NEOPIXELBUS_H
+
+/*
+ * NeoPixelBus for the host. The colors and features are the library's,
+ * including its float HSB to RGB conversion, which is what hsvToRgb() is
+ * checked against. The bus doesn't send anything: each Show() that would
+ * have gone out records the frame, in wire order, so tests can look at
+ * exactly what the strip would have been sent.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+struct HsbColor {
+  HsbColor(float h, float s, float b) : H(h), S(s), B(b) {}
+  HsbColor() {}
+
+  float H;
+  float S;
+  float B;
+};
+
+struct RgbColor {
+  RgbColor(uint8_t r, uint8_t g, uint8_t b) : R(r), G(g), B(b) {}
+  RgbColor(uint8_t brightness) : R(brightness), G(brightness), B(brightness) {}
+  RgbColor() : R(0), G(0), B(0) {}
+
+  RgbColor(const HsbColor& color) {
+    float r;
+    float g;
+    float b;
+
+    float h = color.H;
+    float s = color.S;
+    float v = color.B;
+
+    if (color.S == 0.0f) {
+      r = g = b = v; // achromatic or black
+    } else {
+      if (h < 0.0f) {
+        h += 1.0f;
+      } else if (h >= 1.0f) {
+        h -= 1.0f;
+      }
+      h *= 6.0f;
+      int i = (int)h;
+      float f = h - i;
+      float q = v * (1.0f - s * f);
+      float p = v * (1.0f - s);
+      float t = v * (1.0f - s * (1.0f - f));
+      switch (i) {
+        case 0: r = v; g = t; b = p; break;
+        case 1: r = q; g = v; b = p; break;
+        case 2: r = p; g = v; b = t; break;
+        case 3: r = p; g = q; b = v; break;
+        case 4: r = t; g = p; b = v; break;
+        default: r = v; g = p; b = q; break;
+      }
+    }
+
+    R = (uint8_t)(r * 255.0f);
+    G = (uint8_t)(g * 255.0f);
+    B = (uint8_t)(b * 255.0f);
+  }
+
+  bool operator==(const RgbColor& other) const { return R == other.R && G == other.G && B == other.B; }
+  bool operator!=(const RgbColor& other) const { return !(*this == other); }
+
+  uint8_t R;
+  uint8_t G;
+  uint8_t B;
+};
+
+struct RgbwColor {
+  RgbwColor(uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0) : R(r), G(g), B(b), W(w) {}
+  RgbwColor(uint8_t brightness) : R(0), G(0), B(0), W(brightness) {}
+  RgbwColor() : R(0), G(0), B(0), W(0) {}
+
+  bool operator==(const RgbwColor& other) const { return R == other.R && G == other.G && B == other.B && W == other.W; }
+  bool operator!=(const RgbwColor& other) const { return !(*this == other); }
+
+  uint8_t R;
+  uint8_t G;
+  uint8_t B;
+  uint8_t W;
+};
+
+// The byte order each strip type expects on the wire
+template <uint8_t R, uint8_t G, uint8_t B>
+struct NeoHostRgbFeature {
+  typedef RgbColor ColorObject;
+  static const size_t PixelSize = 3;
+
+  static void applyPixelColor(uint8_t *pPixels, uint16_t indexPixel, ColorObject color) {
+    uint8_t *p = pPixels + indexPixel * PixelSize;
+    p[R] = color.R;
+    p[G] = color.G;
+    p[B] = color.B;
+  }
+
+  static ColorObject retrievePixelColor(const uint8_t *pPixels, uint16_t indexPixel) {
+    const uint8_t *p = pPixels + indexPixel * PixelSize;
+    return ColorObject(p[R], p[G], p[B]);
+  }
+};
+
+template <uint8_t R, uint8_t G, uint8_t B, uint8_t W>
+struct NeoHostRgbwFeature {
+  typedef RgbwColor ColorObject;
+  static const size_t PixelSize = 4;
+
+  static void applyPixelColor(uint8_t *pPixels, uint16_t indexPixel, ColorObject color) {
+    uint8_t *p = pPixels + indexPixel * PixelSize;
+    p[R] = color.R;
+    p[G] = color.G;
+    p[B] = color.B;
+    p[W] = color.W;
+  }
+
+  static ColorObject retrievePixelColor(const uint8_t *pPixels, uint16_t indexPixel) {
+    const uint8_t *p = pPixels + indexPixel * PixelSize;
+    return ColorObject(p[R], p[G], p[B], p[W]);
+  }
+};
+
+typedef NeoHostRgbFeature<1, 0, 2> NeoGrbFeature;
+typedef NeoHostRgbFeature<0, 1, 2> NeoRgbFeature;
+typedef NeoHostRgbwFeature<1, 0, 2, 3> NeoGrbwFeature;
+typedef NeoHostRgbwFeature<0, 1, 2, 3> NeoRgbwFeature;
+
+// The methods only pick the timing, which doesn't matter here
+struct NeoEsp32RmtNWs2812xMethod {};
+struct NeoEsp32RmtNSk6812Method {};
+
+enum NeoBusChannel {
+  NeoBusChannel_0, NeoBusChannel_1, NeoBusChannel_2, NeoBusChannel_3,
+  NeoBusChannel_4, NeoBusChannel_5, NeoBusChannel_6, NeoBusChannel_7
+};
+
+// What tests see of a bus, whatever its feature and method
+class HostPixelBus {
+public:
+  // Every bus that exists right now, in the order they were made
+  static std::vector<HostPixelBus*>& getBuses() { static std::vector<HostPixelBus*> buses; return buses; }
+
+  uint16_t PixelCount() const { return count; }
+  size_t PixelSize() const { return pixelSize; }
+  size_t PixelsSize() const { return pixels.size(); }
+  uint8_t* Pixels() { return pixels.data(); }
+
+  bool IsDirty() const { return dirty; }
+  void Dirty() { dirty = true; }
+  void ResetDirty() { dirty = false; }
+
+  uint8_t getPin() const { return pin; }
+  NeoBusChannel getChannel() const { return channel; }
+
+  // Number of frames that have actually gone out, and the last of them
+  uint32_t getShows() const { return shows; }
+  const std::vector<uint8_t>& getShown() const { return shown; }
+
+  void Begin() {}
+  bool CanShow() const { return true; }
+
+  void Show(bool maintainBufferConsistency = true) {
+    (void)maintainBufferConsistency;
+    if (!dirty) {
+      return;
+    }
+    shown.assign(pixels.begin(), pixels.end());
+    shows++;
+    dirty = false;
+  }
+
+protected:
+  HostPixelBus(uint16_t count, size_t pixelSize, uint8_t pin, NeoBusChannel channel) :
+      count(count), pixelSize(pixelSize), pin(pin), channel(channel), pixels(count * pixelSize, 0), dirty(true), shows(0) {
+    getBuses().push_back(this);
+  }
+
+  virtual ~HostPixelBus() {
+    std::vector<HostPixelBus*>& buses = getBuses();
+    buses.erase(std::remove(buses.begin(), buses.end(), this), buses.end());
+  }
+
+  uint16_t count;
+  size_t pixelSize;
+  uint8_t pin;
+  NeoBusChannel channel;
+  std::vector<uint8_t> pixels;
+  bool dirty;
+  uint32_t shows;
+  std::vector<uint8_t> shown;
+};
+
+template <typename T_COLOR_FEATURE, typename T_METHOD>
+class NeoPixelBus : public HostPixelBus {
+public:
+  typedef typename T_COLOR_FEATURE::ColorObject ColorObject;
+
+  NeoPixelBus(uint16_t countPixels, uint8_t pin, NeoBusChannel channel = NeoBusChannel_0) :
+      HostPixelBus(countPixels, T_COLOR_FEATURE::PixelSize, pin, channel) {}
+
+  void SetPixelColor(uint16_t indexPixel, ColorObject color) {
+    if (indexPixel < count) {
+      T_COLOR_FEATURE::applyPixelColor(pixels.data(), indexPixel, color);
+      Dirty();
+    }
+  }
+
+  ColorObject GetPixelColor(uint16_t indexPixel) const {
+    return indexPixel < count ? T_COLOR_FEATURE::retrievePixelColor(pixels.data(), indexPixel) : ColorObject(0);
+  }
+
+  void ClearTo(ColorObject color) {
+    for (uint16_t index=0; index < count; index++) {
+      T_COLOR_FEATURE::applyPixelColor(pixels.data(), index, color);
+    }
+    Dirty();
+  }
+};
+
+#endif // HOST_NEOPIXELBUS_H
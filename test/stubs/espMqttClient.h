@@ -0,0 +1,141 @@
+#ifndef HOST_ESPMQTTCLIENT_H
+#define HOST_ESPMQTTCLIENT_H
+
+/*
+ * espMqttClient for the host. Nothing goes over the network: a test plays
+ * the broker's side with connectTo(), disconnectFrom() and deliver(), which
+ * call back just as the library's own task would. What the client was
+ * asked to subscribe to and publish is recorded.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace espMqttClientTypes {
+
+enum class UseInternalTask {
+  NO = 0,
+  YES = 1,
+};
+
+enum class DisconnectReason : uint8_t {
+  USER_OK = 0,
+  MQTT_UNACCEPTABLE_PROTOCOL_VERSION = 1,
+  MQTT_IDENTIFIER_REJECTED = 2,
+  MQTT_SERVER_UNAVAILABLE = 3,
+  MQTT_MALFORMED_CREDENTIALS = 4,
+  MQTT_NOT_AUTHORIZED = 5,
+  TLS_BAD_FINGERPRINT = 6,
+  TCP_DISCONNECTED = 7,
+};
+
+struct MessageProperties {
+  uint8_t qos;
+  bool dup;
+  bool retain;
+  uint16_t packetId;
+};
+
+typedef std::function<void(bool sessionPresent)> OnConnectCallback;
+typedef std::function<void(DisconnectReason reason)> OnDisconnectCallback;
+typedef std::function<void(const MessageProperties& properties, const char* topic, const uint8_t* payload, size_t len, size_t index, size_t total)> OnMessageCallback;
+
+}  // namespace espMqttClientTypes
+
+class espMqttClientSecure {
+public:
+  // Every client that exists right now, in the order they were made
+  static std::vector<espMqttClientSecure*>& getClients() { static std::vector<espMqttClientSecure*> clients; return clients; }
+
+  explicit espMqttClientSecure(espMqttClientTypes::UseInternalTask useInternalTask = espMqttClientTypes::UseInternalTask::YES) {
+    (void)useInternalTask;
+    getClients().push_back(this);
+  }
+
+  ~espMqttClientSecure() {
+    std::vector<espMqttClientSecure*>& clients = getClients();
+    clients.erase(std::remove(clients.begin(), clients.end(), this), clients.end());
+  }
+
+  espMqttClientSecure& setServer(const char *host, uint16_t port) { this->host = host; this->port = port; return *this; }
+  espMqttClientSecure& setCredentials(const char *username, const char *password) { (void)username; (void)password; return *this; }
+  espMqttClientSecure& setClientId(const char *clientId) { this->clientId = clientId; return *this; }
+  espMqttClientSecure& setInsecure() { return *this; }
+  espMqttClientSecure& setCleanSession(bool cleanSession) { (void)cleanSession; return *this; }
+  espMqttClientSecure& onConnect(espMqttClientTypes::OnConnectCallback callback) { connectCallback = callback; return *this; }
+  espMqttClientSecure& onDisconnect(espMqttClientTypes::OnDisconnectCallback callback) { disconnectCallback = callback; return *this; }
+  espMqttClientSecure& onMessage(espMqttClientTypes::OnMessageCallback callback) { messageCallback = callback; return *this; }
+
+  // Only asks, connectTo() is what says it worked
+  bool connect() { connectRequests++; return true; }
+  bool disconnect(bool force = false) { (void)force; return true; }
+  bool connected() const { return isConnected; }
+
+  uint16_t subscribe(const char *topic, uint8_t qos) { (void)qos; subscriptions.push_back(topic); return ++packetId; }
+  uint16_t publish(const char *topic, uint8_t qos, bool retain, const char *payload) {
+    (void)qos;
+    (void)retain;
+    published.push_back(std::make_pair(std::string(topic), std::string(payload)));
+    return ++packetId;
+  }
+
+  // The broker's side
+  void connectTo(bool sessionPresent = false) {
+    isConnected = true;
+    if (connectCallback) {
+      connectCallback(sessionPresent);
+    }
+  }
+
+  void disconnectFrom(espMqttClientTypes::DisconnectReason reason = espMqttClientTypes::DisconnectReason::TCP_DISCONNECTED) {
+    isConnected = false;
+    if (disconnectCallback) {
+      disconnectCallback(reason);
+    }
+  }
+
+  // A message, handed over in pieces of at most fragment bytes as the library does with large ones
+  void deliver(const char *topic, const char *payload, size_t length, size_t fragment) {
+    espMqttClientTypes::MessageProperties properties = { 0, false, false, 0 };
+    if (length == 0) {
+      if (messageCallback) {
+        messageCallback(properties, topic, (const uint8_t*)payload, 0, 0, 0);
+      }
+      return;
+    }
+    for (size_t index=0; index < length; index += fragment) {
+      if (messageCallback) {
+        messageCallback(properties, topic, (const uint8_t*)payload + index, std::min(fragment, length - index), index, length);
+      }
+    }
+  }
+
+  const std::string& getHost() const { return host; }
+  uint16_t getPort() const { return port; }
+  const std::string& getClientId() const { return clientId; }
+  uint32_t getConnectRequests() const { return connectRequests; }
+  const std::vector<std::string>& getSubscriptions() const { return subscriptions; }
+  // Topic and payload of everything published, oldest first
+  const std::vector<std::pair<std::string, std::string> >& getPublished() const { return published; }
+
+private:
+  std::string host;
+  uint16_t port = 0;
+  std::string clientId;
+  bool isConnected = false;
+  uint32_t connectRequests = 0;
+  uint16_t packetId = 0;
+  std::vector<std::string> subscriptions;
+  std::vector<std::pair<std::string, std::string> > published;
+
+  espMqttClientTypes::OnConnectCallback connectCallback;
+  espMqttClientTypes::OnDisconnectCallback disconnectCallback;
+  espMqttClientTypes::OnMessageCallback messageCallback;
+};
+
+#endif // HOST_ESPMQTTCLIENT_H
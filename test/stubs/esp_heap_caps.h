@@ -0,0 +1,12 @@
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+// There is no fixed heap on the host to run out of
+inline size_t heap_caps_get_largest_free_block(uint32_t) { return 0; }
+
+#endif // HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,136 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+/*
+ * The parts of FreeRTOS the lights and the broker use, for a host where
+ * everything runs on the one thread. There is a single current task, a
+ * notification is just a count, and blocking for a number of ticks moves
+ * the clock on by that much (a tick is a millisecond) instead of sleeping.
+ * Events set with atMicros() happen on the way, and one that notifies the
+ * task ends its wait there. Nothing ever blocks for ever: a wait that would
+ * is returned from once there are no events left.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <deque>
+#include <vector>
+#include "HostClock.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskIDLE_PRIORITY 0
+
+struct HostTask {
+  uint32_t notifications = 0;
+};
+
+typedef HostTask* TaskHandle_t;
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { static HostTask current; return &current; }
+inline TickType_t xTaskGetTickCount() { return hostMicros() / 1000; }
+inline void vTaskDelay(TickType_t ticks) { advanceMicros(ticks * 1000); }
+
+inline void xTaskNotifyGive(TaskHandle_t task) { task->notifications++; }
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  uint32_t notifications = task->notifications;
+  if (notifications) {
+    task->notifications = clearOnExit ? 0 : notifications - 1;
+    return notifications;
+  }
+
+  uint32_t until = hostMicros() + ticksToWait * 1000;
+  if (ticksToWait == portMAX_DELAY) {
+    until = hostEvents().empty() ? hostMicros() : hostEvents().rbegin()->first;
+  }
+  runUntil(until, [task]() { return task->notifications > 0; });
+
+  notifications = task->notifications;
+  if (notifications) {
+    task->notifications = clearOnExit ? 0 : notifications - 1;
+  }
+  return notifications;
+}
+
+// Items are copied in and out by value, as FreeRTOS does
+struct HostQueue {
+  HostQueue(UBaseType_t length, UBaseType_t itemSize) : length(length), itemSize(itemSize) {}
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  std::deque<std::vector<uint8_t> > items;
+};
+
+typedef HostQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) { return new HostQueue(length, itemSize); }
+inline void vQueueDelete(QueueHandle_t queue) { delete queue; }
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) { return queue->items.size(); }
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t) {
+  if (queue->items.size() >= queue->length) {
+    return pdFAIL;
+  }
+  const uint8_t *bytes = (const uint8_t*)item;
+  queue->items.push_back(std::vector<uint8_t>(bytes, bytes + queue->itemSize));
+  return pdPASS;
+}
+
+inline BaseType_t xQueueOverwrite(QueueHandle_t queue, const void *item) {
+  queue->items.clear();
+  return xQueueSend(queue, item, 0);
+}
+
+inline BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t) {
+  if (queue->items.empty()) {
+    return pdFALSE;
+  }
+  memcpy(item, queue->items.front().data(), queue->itemSize);
+  return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticksToWait) {
+  if (!xQueuePeek(queue, item, ticksToWait)) {
+    return pdFALSE;
+  }
+  queue->items.pop_front();
+  return pdTRUE;
+}
+
+// There is only the one task, so a mutex is never found taken
+struct HostSemaphore {
+  bool taken = false;
+};
+
+typedef HostSemaphore* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return new HostSemaphore(); }
+inline void vSemaphoreDelete(SemaphoreHandle_t semaphore) { delete semaphore; }
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t) {
+  if (semaphore->taken) {
+    return pdFALSE;
+  }
+  semaphore->taken = true;
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  if (!semaphore->taken) {
+    return pdFALSE;
+  }
+  semaphore->taken = false;
+  return pdTRUE;
+}
+
+#endif // HOST_FREERTOS_H
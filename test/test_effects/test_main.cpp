@@ -0,0 +1,214 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "Effects.h"
+
+/*
+ * The effects on their own, straight into a FrameBuffer: that they stay
+ * in their window and only dirty what they change, and what a frame of each
+ * costs to render at 36, 255 and 1000 LEDs.
+ */
+
+static const uint16_t STRIP_LENGTHS[] = { 36, 255, 1000 };
+static const int BENCHMARK_FRAMES = 2000;
+static const uint32_t FRAME_MS = 16;
+
+// Far more than any effect should need on a PC. The LED task gets 16 ms for a whole frame on a much slower CPU.
+static const double BUDGET_NANOS = 1000000;
+
+struct NamedEffect {
+  const char *name;
+  Effect *effect;
+};
+
+static RainbowEffect rainbow;
+static ChaseEffect chase;
+static CometEffect comet;
+static SparkleEffect sparkle;
+static GradientEffect gradient;
+static ProgressEffect progress;
+
+static const NamedEffect EFFECTS[] = {
+  { "Rainbow", &rainbow },
+  { "Chase", &chase },
+  { "Comet", &comet },
+  { "Sparkle", &sparkle },
+  { "Gradient", &gradient },
+  { "Progress", &progress },
+};
+static const int NUM_EFFECTS = sizeof(EFFECTS) / sizeof(EFFECTS[0]);
+
+static EffectParams makeParams() {
+  EffectParams params;
+  params.hue = 100;
+  params.sat = 255;
+  params.val = 200;
+  params.perMin = 30;
+  params.elapsedMs = 0;
+  params.progress = 37;
+  params.segment = 0;
+  return params;
+}
+
+static bool isBlack(const RgbColor& color) {
+  return color.R == 0 && color.G == 0 && color.B == 0;
+}
+
+void setUp(void) {
+  for (int i=0; i < NUM_EFFECTS; i++) {
+    EFFECTS[i].effect->reset();
+  }
+}
+
+void tearDown(void) {
+}
+
+void test_effects_stay_in_their_window(void) {
+  for (int e=0; e < NUM_EFFECTS; e++) {
+    FrameBuffer frame(60);
+    frame.clearDirty();
+    frame.setWindow(20, 20);
+
+    EffectParams params = makeParams();
+    for (int i=0; i < 20; i++) {
+      params.elapsedMs += FRAME_MS;
+      EFFECTS[e].effect->render(frame, params);
+    }
+    frame.clearWindow();
+
+    TEST_ASSERT_TRUE_MESSAGE(frame.isDirty(), EFFECTS[e].name);
+    TEST_ASSERT_GREATER_OR_EQUAL(20, frame.getDirtyStart());
+    TEST_ASSERT_LESS_OR_EQUAL(40, frame.getDirtyEnd());
+    for (uint16_t i=0; i < frame.getCount(); i++) {
+      if (i < 20 || i >= 40) {
+        TEST_ASSERT_TRUE_MESSAGE(isBlack(frame.getPixel(i)), EFFECTS[e].name);
+      }
+    }
+  }
+}
+
+void test_same_fill_leaves_the_frame_clean(void) {
+  FrameBuffer frame(60);
+  RgbColor color = hsvToRgb(100, 255, 200);
+  frame.fill(color);
+  TEST_ASSERT_TRUE(frame.isDirty());
+  frame.clearDirty();
+
+  frame.fill(color);
+  frame.setPixel(10, color);
+  TEST_ASSERT_FALSE(frame.isDirty());
+
+  frame.setPixel(10, RgbColor(0, 0, 0));
+  TEST_ASSERT_EQUAL(10, frame.getDirtyStart());
+  TEST_ASSERT_EQUAL(11, frame.getDirtyEnd());
+}
+
+void test_still_effects_leave_the_frame_clean(void) {
+  for (int e=0; e < NUM_EFFECTS; e++) {
+    Effect *effect = EFFECTS[e].effect;
+    if (effect->isAnimated()) {
+      continue;
+    }
+
+    FrameBuffer frame(100);
+    EffectParams params = makeParams();
+    effect->render(frame, params);
+    frame.clearDirty();
+
+    params.elapsedMs += 1000;
+    effect->render(frame, params);
+    TEST_ASSERT_FALSE_MESSAGE(frame.isDirty(), EFFECTS[e].name);
+  }
+}
+
+void test_chase_lights_every_third_pixel(void) {
+  FrameBuffer frame(30);
+  EffectParams params = makeParams();
+  chase.render(frame, params);
+
+  int lit = 0;
+  for (uint16_t i=0; i < frame.getCount(); i++) {
+    if (!isBlack(frame.getPixel(i))) {
+      TEST_ASSERT_TRUE(i < 3 || !isBlack(frame.getPixel(i - 3)));
+      lit++;
+    }
+  }
+  TEST_ASSERT_EQUAL(10, lit);
+}
+
+void test_progress_lights_its_share(void) {
+  FrameBuffer frame(100);
+  EffectParams params = makeParams();
+  params.progress = 25;
+  progress.render(frame, params);
+
+  TEST_ASSERT_FALSE(isBlack(frame.getPixel(24)));
+  TEST_ASSERT_TRUE(isBlack(frame.getPixel(25)));
+}
+
+void test_progress_follows_its_segment_when_it_moves(void) {
+  FrameBuffer frame(100);
+  EffectParams params = makeParams();
+  params.progress = 50;
+
+  frame.setWindow(0, 40);
+  progress.render(frame, params);
+
+  // Same span, same length, further along the strip
+  frame.setWindow(60, 40);
+  progress.render(frame, params);
+
+  TEST_ASSERT_FALSE(isBlack(frame.getPixel(0)));
+  TEST_ASSERT_FALSE(isBlack(frame.getPixel(19)));
+  TEST_ASSERT_TRUE(isBlack(frame.getPixel(20)));
+}
+
+void test_benchmark_effects(void) {
+  printf("\n%-10s", "ns/frame");
+  for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+    printf("%10u %8s", STRIP_LENGTHS[n], "dirty");
+  }
+  printf("\n");
+
+  for (int e=0; e < NUM_EFFECTS; e++) {
+    printf("%-10s", EFFECTS[e].name);
+    for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+      FrameBuffer frame(STRIP_LENGTHS[n]);
+      Effect *effect = EFFECTS[e].effect;
+      effect->reset();
+
+      EffectParams params = makeParams();
+      std::chrono::nanoseconds total(0);
+      uint32_t dirtyPixels = 0;
+      for (int i=0; i < BENCHMARK_FRAMES; i++) {
+        params.elapsedMs += FRAME_MS;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        effect->render(frame, params);
+        total += std::chrono::steady_clock::now() - start;
+
+        // What would have to be sent to the strip
+        if (frame.isDirty()) {
+          dirtyPixels += frame.getDirtyEnd() - frame.getDirtyStart();
+        }
+        frame.clearDirty();
+      }
+
+      double nanos = (double)total.count() / BENCHMARK_FRAMES;
+      printf("%10.0f %8u", nanos, dirtyPixels / BENCHMARK_FRAMES);
+      TEST_ASSERT_LESS_THAN_MESSAGE(BUDGET_NANOS, nanos, EFFECTS[e].name);
+    }
+    printf("\n");
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_effects_stay_in_their_window);
+  RUN_TEST(test_same_fill_leaves_the_frame_clean);
+  RUN_TEST(test_still_effects_leave_the_frame_clean);
+  RUN_TEST(test_chase_lights_every_third_pixel);
+  RUN_TEST(test_progress_lights_its_share);
+  RUN_TEST(test_progress_follows_its_segment_when_it_moves);
+  RUN_TEST(test_benchmark_effects);
+  return UNITY_END();
+}
@@ -0,0 +1,202 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include <string>
+#include <ArduinoJson.h>
+#include "JsonStreamFilter.h"
+
+/*
+ * JsonStreamFilter against ArduinoJson's own filtering: docs/message.json, a
+ * full report with AMS data, has to come out the same however it is split
+ * into fragments, and the same as deserializeJson() with the same filter
+ * would have made of it. Also times both on that report.
+ */
+
+static const size_t OUTPUT_SIZE = 4096;
+static const int BENCHMARK_REPORTS = 2000;
+
+static JsonDocument filter;
+static std::string message;
+
+// The project directory is the working directory under pio test, but not necessarily elsewhere
+static std::string readProjectFile(const char *path) {
+  std::string dir = __FILE__;
+  std::string candidates[] = {
+    path,
+    dir.substr(0, dir.rfind("test/test_filter")) + path,
+    std::string("../../") + path,
+  };
+
+  for (const std::string& candidate : candidates) {
+    FILE *file = fopen(candidate.c_str(), "rb");
+    if (file) {
+      std::string contents;
+      char buf[4096];
+      size_t n;
+      while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        contents.append(buf, n);
+      }
+      fclose(file);
+      return contents;
+    }
+  }
+
+  return std::string();
+}
+
+// The keys MQTTBroker keeps
+static void buildFilter() {
+  const char *printKeys[] = {
+    "stg_cur", "hms", "print_error", "home_flag", "lights_report", "mc_percent", "layer_num",
+    "total_layer_num", "gcode_state", "mc_remaining_time", "nozzle_temper", "nozzle_target_temper",
+    "bed_temper", "bed_target_temper", "chamber_temper", "cooling_fan_speed", "big_fan1_speed",
+    "big_fan2_speed", "heatbreak_fan_speed"
+  };
+  for (const char *key : printKeys) {
+    filter["print"][key] = true;
+  }
+  filter["print"]["ams"]["ams"][0]["id"] = true;
+  filter["print"]["ams"]["ams"][0]["tray"][0]["id"] = true;
+  filter["print"]["ams"]["ams"][0]["tray"][0]["tray_color"] = true;
+  filter["print"]["ams"]["ams"][0]["tray"][0]["remain"] = true;
+}
+
+// Feeds json through a filter in fragments of at most chunk bytes
+static std::string streamFilter(const std::string& json, size_t chunk, JsonStreamFilter& streamFilter) {
+  static char output[OUTPUT_SIZE];
+  streamFilter.begin(filter.as<JsonVariantConst>(), output, sizeof(output));
+  for (size_t i=0; i < json.size(); i += chunk) {
+    streamFilter.feed(json.data() + i, std::min(chunk, json.size() - i));
+  }
+  return std::string(streamFilter.getOutput(), streamFilter.getLength());
+}
+
+// What deserializeJson() makes of json with the filter, written back out
+static std::string arduinoJsonFilter(const std::string& json) {
+  JsonDocument doc;
+  DeserializationError error = deserializeJson(doc, json, DeserializationOption::Filter(filter));
+  TEST_ASSERT_FALSE_MESSAGE(error, error.c_str());
+  std::string out;
+  serializeJson(doc, out);
+  return out;
+}
+
+// The same, but of what the stream filter kept
+static std::string reserialize(const std::string& json) {
+  JsonDocument doc;
+  DeserializationError error = deserializeJson(doc, json);
+  TEST_ASSERT_FALSE_MESSAGE(error, error.c_str());
+  std::string out;
+  serializeJson(doc, out);
+  return out;
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_message_json_matches_arduinojson(void) {
+  JsonStreamFilter streamFilter;
+  std::string kept = ::streamFilter(message, message.size(), streamFilter);
+
+  TEST_ASSERT_TRUE_MESSAGE(streamFilter.isComplete(), streamFilter.getError());
+  TEST_ASSERT_GREATER_THAN(0, streamFilter.getKept());
+  TEST_ASSERT_LESS_THAN(message.size() / 4, kept.size());
+  TEST_ASSERT_EQUAL_STRING(arduinoJsonFilter(message).c_str(), reserialize(kept).c_str());
+}
+
+void test_fragmenting_makes_no_difference(void) {
+  JsonStreamFilter streamFilter;
+  std::string whole = ::streamFilter(message, message.size(), streamFilter);
+
+  static const size_t CHUNKS[] = { 1, 2, 3, 5, 7, 13, 64, 100, 1000, 1024, 4096 };
+  for (size_t chunk : CHUNKS) {
+    std::string kept = ::streamFilter(message, chunk, streamFilter);
+    TEST_ASSERT_TRUE_MESSAGE(streamFilter.isComplete(), streamFilter.getError());
+    TEST_ASSERT_EQUAL_STRING(whole.c_str(), kept.c_str());
+  }
+}
+
+void test_strings_that_look_like_json(void) {
+  std::string json = R"({"skip":"}\"{[","print":{"gcode_state":"R\"U\\N","skip":{"a":[1,{"b":"]}"}]},)"
+    R"("stg_cur":2,"lights_report":[{"node":"chamber_light","mode":"on"}]}})";
+
+  JsonStreamFilter streamFilter;
+  for (size_t chunk=1; chunk <= json.size(); chunk++) {
+    std::string kept = ::streamFilter(json, chunk, streamFilter);
+    TEST_ASSERT_TRUE_MESSAGE(streamFilter.isComplete(), streamFilter.getError());
+    TEST_ASSERT_EQUAL(3, streamFilter.getKept());
+    TEST_ASSERT_EQUAL_STRING(arduinoJsonFilter(json).c_str(), reserialize(kept).c_str());
+  }
+}
+
+void test_report_with_nothing_kept(void) {
+  JsonStreamFilter streamFilter;
+  ::streamFilter(R"({"info":{"command":"get_version","module":[{"name":"ota"}]}})", 7, streamFilter);
+
+  TEST_ASSERT_TRUE(streamFilter.isComplete());
+  TEST_ASSERT_EQUAL(0, streamFilter.getKept());
+}
+
+void test_truncated_report_is_not_complete(void) {
+  JsonStreamFilter streamFilter;
+  ::streamFilter(message.substr(0, message.size() / 2), 1024, streamFilter);
+
+  TEST_ASSERT_FALSE(streamFilter.isComplete());
+}
+
+void test_output_that_does_not_fit_is_an_error(void) {
+  JsonStreamFilter streamFilter;
+  char output[32];
+  streamFilter.begin(filter.as<JsonVariantConst>(), output, sizeof(output));
+  streamFilter.feed(message.data(), message.size());
+
+  TEST_ASSERT_FALSE(streamFilter.isComplete());
+  TEST_ASSERT_EQUAL_STRING("filtered output too long", streamFilter.getError());
+  TEST_ASSERT_LESS_OR_EQUAL(sizeof(output), strlen(output) + 1);
+}
+
+void test_benchmark_filtering(void) {
+  JsonStreamFilter streamFilter;
+  std::string kept;
+
+  // As the MQTT client hands it over, in fragments
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int i=0; i < BENCHMARK_REPORTS; i++) {
+    kept = ::streamFilter(message, 1024, streamFilter);
+  }
+  std::chrono::nanoseconds streamed = std::chrono::steady_clock::now() - start;
+
+  // What it replaced: the whole report reassembled, then parsed with a filter
+  JsonDocument doc;
+  start = std::chrono::steady_clock::now();
+  for (int i=0; i < BENCHMARK_REPORTS; i++) {
+    deserializeJson(doc, message, DeserializationOption::Filter(filter));
+  }
+  std::chrono::nanoseconds parsed = std::chrono::steady_clock::now() - start;
+
+  printf("\nmessage.json: %u bytes in, %u kept\n", (unsigned)message.size(), (unsigned)kept.size());
+  printf("ns/report  stream filter %.0f  deserializeJson with filter %.0f\n",
+    (double)streamed.count() / BENCHMARK_REPORTS, (double)parsed.count() / BENCHMARK_REPORTS);
+}
+
+int main() {
+  buildFilter();
+  message = readProjectFile("docs/message.json");
+
+  UNITY_BEGIN();
+  if (message.empty()) {
+    printf("docs/message.json not found, run from the project directory\n");
+    return 1;
+  }
+  RUN_TEST(test_message_json_matches_arduinojson);
+  RUN_TEST(test_fragmenting_makes_no_difference);
+  RUN_TEST(test_strings_that_look_like_json);
+  RUN_TEST(test_report_with_nothing_kept);
+  RUN_TEST(test_truncated_report_is_not_complete);
+  RUN_TEST(test_output_that_does_not_fit_is_an_error);
+  RUN_TEST(test_benchmark_filtering);
+  return UNITY_END();
+}
@@ -0,0 +1,192 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <set>
+#include <string>
+#include <vector>
+#include <ArduinoJson.h>
+#include "HmsDatabase.h"
+
+/*
+ * The generated table against docs/codes.json, which it was built from:
+ * every code has to come back with exactly its message, and codes that
+ * aren't there must not be found in whatever slot they hash to. Also times
+ * lookups and compares the table's size with the text it replaces.
+ */
+
+static const int BENCHMARK_PASSES = 200;
+
+struct Code {
+  uint64_t code;
+  std::string message;
+};
+
+static std::vector<Code> codes;
+static std::set<uint64_t> known;
+static std::string version;
+static size_t sourceBytes = 0;
+
+// The project directory is the working directory under pio test, but not necessarily elsewhere
+static std::string readProjectFile(const char *path) {
+  std::string dir = __FILE__;
+  std::string candidates[] = {
+    path,
+    dir.substr(0, dir.rfind("test/test_hms")) + path,
+    std::string("../../") + path,
+  };
+
+  for (const std::string& candidate : candidates) {
+    FILE *file = fopen(candidate.c_str(), "rb");
+    if (file) {
+      std::string contents;
+      char buf[4096];
+      size_t n;
+      while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        contents.append(buf, n);
+      }
+      fclose(file);
+      return contents;
+    }
+  }
+
+  return std::string();
+}
+
+// As load_codes() in .build_hms.py does
+static bool loadCodes() {
+  std::string json = readProjectFile("docs/codes.json");
+  JsonDocument doc;
+  if (json.empty() || deserializeJson(doc, json)) {
+    return false;
+  }
+
+  const char *sections[] = { "device_hms", "device_error" };
+  for (const char *section : sections) {
+    JsonArray entries = doc["data"][section]["en"];
+    for (JsonVariant entry : entries) {
+      Code code;
+      code.code = strtoull(entry["ecode"].as<const char*>(), 0, 16);
+      code.message = entry["intro"].as<const char*>();
+      if (known.insert(code.code).second) {
+        codes.push_back(code);
+        sourceBytes += sizeof(code.code) + code.message.size() + 1;
+      }
+    }
+  }
+  // A number, which the generator writes out as a string
+  version = std::to_string(doc["data"]["device_hms"]["ver"].as<uint64_t>());
+
+  return !codes.empty();
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_table_is_up_to_date(void) {
+  TEST_ASSERT_EQUAL_STRING(version.c_str(), HmsDatabase::getVersion());
+  TEST_ASSERT_EQUAL(codes.size(), HmsDatabase::getCount());
+}
+
+void test_every_code_is_described(void) {
+  char message[HmsDatabase::MAX_MESSAGE];
+  for (const Code& code : codes) {
+    char name[24];
+    snprintf(name, sizeof(name), "%016llX", (unsigned long long)code.code);
+
+    TEST_ASSERT_TRUE_MESSAGE(HmsDatabase::contains(code.code), name);
+    TEST_ASSERT_TRUE_MESSAGE(HmsDatabase::describe(code.code, message, sizeof(message)), name);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(code.message.c_str(), message, name);
+  }
+}
+
+// Neighbours of every real code: other bits of attr or code, or an HMS code's halves swapped
+void test_unknown_codes_are_not_found(void) {
+  char message[HmsDatabase::MAX_MESSAGE];
+  uint32_t probes = 0;
+  for (const Code& code : codes) {
+    uint64_t candidates[] = {
+      code.code ^ 1,
+      code.code ^ 0x100,
+      code.code ^ (1ULL << 32),
+      code.code + (1ULL << 48),
+      (code.code >> 32) | (code.code << 32),
+    };
+    for (uint64_t candidate : candidates) {
+      if (known.count(candidate)) {
+        continue;
+      }
+      probes++;
+      TEST_ASSERT_FALSE(HmsDatabase::contains(candidate));
+      TEST_ASSERT_FALSE(HmsDatabase::describe(candidate, message, sizeof(message)));
+      TEST_ASSERT_EQUAL_STRING("unknown", message);
+    }
+  }
+  TEST_ASSERT_GREATER_THAN(codes.size(), probes);
+}
+
+void test_long_messages_are_truncated(void) {
+  for (const Code& code : codes) {
+    if (code.message.size() < 20) {
+      continue;
+    }
+
+    char message[16];
+    memset(message, 'x', sizeof(message));
+    TEST_ASSERT_TRUE(HmsDatabase::describe(code.code, message, sizeof(message)));
+    TEST_ASSERT_EQUAL(sizeof(message) - 1, strlen(message));
+    TEST_ASSERT_EQUAL(0, code.message.compare(0, sizeof(message) - 1, message));
+  }
+
+  // Nowhere to write, so nothing is
+  char untouched = 'x';
+  TEST_ASSERT_TRUE(HmsDatabase::describe(codes[0].code, &untouched, 0));
+  TEST_ASSERT_EQUAL('x', untouched);
+}
+
+void test_benchmark_lookups(void) {
+  char message[HmsDatabase::MAX_MESSAGE];
+  uint32_t found = 0;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int pass=0; pass < BENCHMARK_PASSES; pass++) {
+    for (const Code& code : codes) {
+      found += HmsDatabase::describe(code.code, message, sizeof(message));
+    }
+  }
+  std::chrono::nanoseconds described = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (int pass=0; pass < BENCHMARK_PASSES; pass++) {
+    for (const Code& code : codes) {
+      found += HmsDatabase::contains(code.code ^ 1);
+    }
+  }
+  std::chrono::nanoseconds missed = std::chrono::steady_clock::now() - start;
+
+  // So the loops can't be optimized away
+  TEST_ASSERT_GREATER_OR_EQUAL(codes.size() * BENCHMARK_PASSES, found);
+
+  double lookups = (double)codes.size() * BENCHMARK_PASSES;
+  printf("\n%u codes, %u bytes of table for %u bytes of codes and messages\n",
+    (unsigned)codes.size(), (unsigned)HmsDatabase::getFlashBytes(), (unsigned)sourceBytes);
+  printf("ns/lookup  describe %.1f  miss %.1f\n", described.count() / lookups, missed.count() / lookups);
+}
+
+int main() {
+  UNITY_BEGIN();
+  if (!loadCodes()) {
+    printf("docs/codes.json not found, run from the project directory\n");
+    return 1;
+  }
+  RUN_TEST(test_table_is_up_to_date);
+  RUN_TEST(test_every_code_is_described);
+  RUN_TEST(test_unknown_codes_are_not_found);
+  RUN_TEST(test_long_messages_are_truncated);
+  RUN_TEST(test_benchmark_lookups);
+  return UNITY_END();
+}
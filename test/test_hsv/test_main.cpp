@@ -0,0 +1,88 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "FrameBuffer.h"
+
+/*
+ * hsvToRgb() replaced converting through HsbColor in floating point, and
+ * has to give the same colors: checks every one of the 2^24 inputs against
+ * the float conversion, and times both.
+ *
+ * A PC has a fast FPU, so the two come out close here. The difference is
+ * on the C3, which has none and makes every float operation a library call.
+ * The firmware times both on the chip at boot and shows the cycle counts on
+ * the Info page, which is where to look for what each target saves.
+ */
+
+// What fill() and setPixelColor() used to do. Kept out of line, as hsvToRgb() is, so the
+// benchmark compares the conversions and not what the compiler could inline.
+__attribute__((noinline)) static RgbColor floatHsvToRgb(uint8_t hue, uint8_t sat, uint8_t val) {
+  return HsbColor(hue/256.0, sat/256.0, val/256.0);
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_matches_float_conversion_everywhere(void) {
+  uint32_t mismatches = 0;
+  uint32_t first = 0;
+
+  for (uint32_t hsv=0; hsv < (1 << 24); hsv++) {
+    uint8_t hue = hsv >> 16;
+    uint8_t sat = hsv >> 8;
+    uint8_t val = hsv;
+    if (hsvToRgb(hue, sat, val) != floatHsvToRgb(hue, sat, val)) {
+      if (mismatches++ == 0) {
+        first = hsv;
+      }
+    }
+  }
+
+  char message[64];
+  snprintf(message, sizeof(message), "first mismatch at h=%u s=%u v=%u", first >> 16, (first >> 8) & 0xff, first & 0xff);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, mismatches, message);
+}
+
+void test_known_colors(void) {
+  TEST_ASSERT_TRUE(hsvToRgb(0, 0, 0) == RgbColor(0, 0, 0));
+  TEST_ASSERT_TRUE(hsvToRgb(123, 45, 0) == RgbColor(0, 0, 0));
+  TEST_ASSERT_TRUE(hsvToRgb(0, 0, 255) == RgbColor(254, 254, 254));
+  TEST_ASSERT_TRUE(hsvToRgb(0, 255, 255) == RgbColor(254, 0, 0));
+}
+
+// Both converters over the same spread of inputs, so neither is helped by a constant input
+template <RgbColor (*CONVERT)(uint8_t, uint8_t, uint8_t)>
+static double nanosPerConversion(uint32_t conversions) {
+  uint32_t checksum = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (uint32_t i=0; i < conversions; i++) {
+    uint32_t hsv = i * 2654435761u;
+    RgbColor color = CONVERT(hsv >> 24, hsv >> 16, hsv >> 8);
+    checksum += color.R + color.G + color.B;
+  }
+  std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+  // So the loop can't be optimized away
+  TEST_ASSERT_NOT_EQUAL(0, checksum);
+  return (double)elapsed.count() / conversions;
+}
+
+void test_benchmark_conversion(void) {
+  const uint32_t CONVERSIONS = 1 << 22;
+
+  double floatNanos = nanosPerConversion<floatHsvToRgb>(CONVERSIONS);
+  double intNanos = nanosPerConversion<hsvToRgb>(CONVERSIONS);
+
+  printf("\nns/conversion  float %.2f  integer %.2f  (%.1fx)\n", floatNanos, intNanos, floatNanos / intNanos);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_float_conversion_everywhere);
+  RUN_TEST(test_known_colors);
+  RUN_TEST(test_benchmark_conversion);
+  return UNITY_END();
+}
@@ -0,0 +1,181 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "BambuLights.h"
+#include "LatencyHistogram.h"
+#include "MQTTBroker.h"
+
+/*
+ * How long a printer report takes to reach the strip: from the report
+ * arriving to the end of the first frame drawn after it, as main.cpp's
+ * "Printer to LED Latency" measures it. Reports arrive at irregular times
+ * while the LED task runs, once as it is now (woken by the broker's
+ * snapshot) and once as it was (polling the broker with a 16 ms delay()
+ * between frames), with the picture both still and animating.
+ *
+ * Each frame takes as long as the timing model says the strip takes to
+ * clock out. Rendering takes no time on the host, and the parse task runs
+ * the moment it is woken, so the device adds those to both loops.
+ */
+
+static const char *SERIAL_NUMBER = "01S00A000000000";
+static const char *REPORT_TOPIC = "device/01S00A000000000/report";
+static const int PIN = 27;
+static const int NUM_REPORTS = 500;
+static const uint32_t POLL_MS = 16;
+
+// Each one changes the chamber light, so each one is a change the LED task is told about
+static const char *LIGHT_REPORTS[] = {
+  R"({"print":{"command":"push_status","lights_report":[{"node":"chamber_light","mode":"off"}]}})",
+  R"({"print":{"command":"push_status","lights_report":[{"node":"chamber_light","mode":"on"}]}})",
+};
+
+static MQTTBroker *broker;
+static espMqttClientSecure *client;
+static BambuLights *lights;
+static uint32_t arrivedMicros;   // For the polling loop, which has no snapshot to say when
+
+static void deliver(const char *report) {
+  arrivedMicros = micros();
+  client->deliver(REPORT_TOPIC, report, strlen(report), 1024);
+  // The parse task runs as soon as it is woken
+  broker->parsePending();
+}
+
+// NUM_REPORTS light changes, 0.7 to 1.3 s apart, at no particular point in a frame
+static void scheduleReports() {
+  uint32_t seed = 12345;
+  uint32_t when = micros();
+  for (int i=0; i < NUM_REPORTS; i++) {
+    seed = seed * 1103515245 + 12345;
+    when += 700000 + (seed >> 8) % 600000;
+    const char *report = LIGHT_REPORTS[i % 2];
+    atMicros(when, [report]() { deliver(report); });
+  }
+}
+
+// The frame, and the time it takes to go out
+static void drawFrame() {
+  lights->setState(BambuLights::printing);
+  lights->loop();
+  advanceMicros(lights->getExpectedFrameMicros());
+}
+
+// The LED task as it is: waits for the broker's snapshot, or the next frame, whichever comes first
+static void runSnapshotLoop(LatencyHistogram& latencies) {
+  MQTTBroker::Snapshot snapshot;
+
+  // Once round after the last report, to draw it
+  for (bool last=false; !last; ) {
+    last = hostEvents().empty();
+    uint32_t receivedMicros = 0;
+    if (broker->receiveSnapshot(snapshot)) {
+      receivedMicros = snapshot.receivedMicros;
+    }
+
+    drawFrame();
+    if (receivedMicros) {
+      latencies.add(micros() - receivedMicros);
+    }
+
+    lights->waitForNextFrame();
+  }
+}
+
+// The LED task as it was: reads the broker every time round, and sleeps for a frame in between
+static void runPollingLoop(LatencyHistogram& latencies) {
+  bool lightWasOn = broker->isLightOn();
+
+  for (bool last=false; !last; ) {
+    last = hostEvents().empty();
+    bool lightOn = broker->isLightOn();
+
+    drawFrame();
+    if (lightOn != lightWasOn) {
+      latencies.add(micros() - arrivedMicros);
+      lightWasOn = lightOn;
+    }
+
+    delay(POLL_MS);
+  }
+}
+
+static void printRow(const char *name, const LatencyHistogram& latencies) {
+  printf("%-20s %8u %8u %8u %8u\n", name, (unsigned)latencies.getCount(), (unsigned)latencies.getAverage(),
+    (unsigned)latencies.getPercentile(990), (unsigned)latencies.getMax());
+}
+
+// Both loops against the same reports, with the printing pattern set to pattern
+static void compareLoops(const char *name, uint8_t pattern, LatencyHistogram& polled, LatencyHistogram& notified) {
+  *(ByteConfigItem*)BambuLights::getPrintingConfig().get("pattern") = pattern;
+
+  scheduleReports();
+  runPollingLoop(polled);
+  TEST_ASSERT_EQUAL(NUM_REPORTS, polled.getCount());
+
+  // Starting from nothing waiting
+  MQTTBroker::Snapshot snapshot;
+  broker->setNotifyTask(xTaskGetCurrentTaskHandle());
+  broker->receiveSnapshot(snapshot);
+  ulTaskNotifyTake(pdTRUE, 0);
+
+  scheduleReports();
+  runSnapshotLoop(notified);
+  TEST_ASSERT_EQUAL(NUM_REPORTS, notified.getCount());
+
+  char row[32];
+  snprintf(row, sizeof(row), "%s, polled", name);
+  printRow(row, polled);
+  snprintf(row, sizeof(row), "%s, notified", name);
+  printRow(row, notified);
+}
+
+void setUp(void) {
+  BambuLights::getNumLEDs() = 36;
+  BambuLights::getMaxLEDs() = 0;
+  BambuLights::getLedPins() = "";
+  BambuLights::getLedType() = LedOutput::grb;
+  BambuLights::getMaxMilliamps() = 0;
+  BambuLights::getFadeTime() = 0;
+  lights = new BambuLights(PIN);
+  lights->begin();
+
+  MQTTBroker::getHost() = "192.168.1.10";
+  MQTTBroker::getSerialNumber() = SERIAL_NUMBER;
+  broker = new MQTTBroker();
+  client = espMqttClientSecure::getClients().back();
+  TEST_ASSERT_TRUE(broker->init("bambulights-test"));
+  broker->connect();
+  client->connectTo();
+  broker->parsePending();
+}
+
+void tearDown(void) {
+  hostEvents().clear();
+  delete broker;
+  broker = 0;
+  client = 0;
+}
+
+void test_report_latency_still_and_animating(void) {
+  printf("\n%-20s %8s %8s %8s %8s\n", "us to the strip", "reports", "avg", "p99", "max");
+
+  LatencyHistogram stillPolled, stillNotified;
+  compareLoops("still", BambuLights::constant, stillPolled, stillNotified);
+  LatencyHistogram movingPolled, movingNotified;
+  compareLoops("animating", BambuLights::pulse, movingPolled, movingNotified);
+
+  // A snapshot wakes the task whatever it was waiting for, so at worst it waits for the frame going out
+  uint32_t frameMicros = lights->getExpectedFrameMicros();
+  TEST_ASSERT_LESS_OR_EQUAL(2 * frameMicros, stillNotified.getMax());
+  TEST_ASSERT_LESS_OR_EQUAL(2 * frameMicros, movingNotified.getMax());
+  // Polling catches a report anywhere up to a poll late, half of one on average
+  TEST_ASSERT_GREATER_THAN(stillNotified.getAverage() + POLL_MS * 1000 / 4, stillPolled.getAverage());
+  TEST_ASSERT_GREATER_THAN(movingNotified.getAverage() + POLL_MS * 1000 / 4, movingPolled.getAverage());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_report_latency_still_and_animating);
+  return UNITY_END();
+}
@@ -0,0 +1,388 @@
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "LedOutput.h"
+
+/*
+ * LedOutput on the recording NeoPixelBus: that writing a frame straight into
+ * the bus buffers gives exactly the bytes SetPixelColor() would have, and how
+ * the two compare at 36, 255 and 1000 LEDs. Also how the strip is split
+ * across pins, what the timing model expects a frame to cost for each
+ * layout and with room reserved, and what gamma and dithering add to
+ * writing a frame.
+ */
+
+static const uint16_t STRIP_LENGTHS[] = { 36, 255, 1000 };
+static const int BENCHMARK_FRAMES = 2000;
+static const uint8_t PIN = 27;
+static const uint8_t PINS[] = { 27, 26, 25, 33, 32, 14, 13, 12 };
+
+typedef NeoPixelBus<NeoGrbFeature, NeoEsp32RmtNWs2812xMethod> GrbBus;
+typedef NeoPixelBus<NeoGrbwFeature, NeoEsp32RmtNSk6812Method> GrbwBus;
+
+// An output on one pin, and the bus it made
+static LedOutput* makeOutput(uint8_t type, uint16_t count, HostPixelBus **bus) {
+  LedOutput *output = LedOutput::create(type);
+  uint8_t pins[] = { PIN };
+  output->configure(count, count, pins, 1);
+  output->begin();
+  *bus = HostPixelBus::getBuses().back();
+  return output;
+}
+
+static RgbColor testColor(uint16_t index) {
+  return hsvToRgb(index * 7, 200, 180);
+}
+
+// Linear, as an output is until it is told otherwise
+static ColorCorrection linear;
+
+// What show() used to do with the dirty part of a frame, corrected as the output does it
+static void setPixelColors(GrbBus& bus, const FrameBuffer& frame) {
+  for (uint16_t i=frame.getDirtyStart(); i < frame.getDirtyEnd(); i++) {
+    bus.SetPixelColor(i, linear.apply(frame.getPixel(i), LedOutput::ROUND_TO_NEAREST));
+  }
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_uniform_frame_matches_set_pixel_color(void) {
+  HostPixelBus *bus;
+  LedOutput *output = makeOutput(LedOutput::grb, 255, &bus);
+  FrameBuffer frame(255);
+  frame.fill(RgbColor(12, 34, 56));
+  output->write(frame);
+
+  GrbBus reference(255, PIN);
+  setPixelColors(reference, frame);
+
+  TEST_ASSERT_EQUAL_MEMORY(reference.Pixels(), bus->Pixels(), reference.PixelsSize());
+  delete output;
+}
+
+void test_mixed_frame_matches_set_pixel_color(void) {
+  HostPixelBus *bus;
+  LedOutput *output = makeOutput(LedOutput::grb, 255, &bus);
+  FrameBuffer frame(255);
+  for (uint16_t i=0; i < 255; i++) {
+    frame.setPixel(i, testColor(i));
+  }
+  output->write(frame);
+
+  GrbBus reference(255, PIN);
+  setPixelColors(reference, frame);
+
+  TEST_ASSERT_EQUAL_MEMORY(reference.Pixels(), bus->Pixels(), reference.PixelsSize());
+  delete output;
+}
+
+void test_rgbw_takes_the_common_part_as_white(void) {
+  HostPixelBus *bus;
+  LedOutput *output = makeOutput(LedOutput::grbw, 36, &bus);
+  FrameBuffer frame(36);
+  frame.fill(RgbColor(200, 150, 100));
+  output->write(frame);
+
+  GrbwBus reference(36, PIN);
+  for (uint16_t i=0; i < 36; i++) {
+    reference.SetPixelColor(i, RgbwColor(100, 50, 0, 100));
+  }
+
+  TEST_ASSERT_EQUAL_MEMORY(reference.Pixels(), bus->Pixels(), reference.PixelsSize());
+  delete output;
+}
+
+void test_strip_is_split_across_pins(void) {
+  size_t before = HostPixelBus::getBuses().size();
+  LedOutput *output = LedOutput::create(LedOutput::grb);
+  output->configure(100, 100, PINS, 3);
+  output->begin();
+
+  // The first run takes the extra LED, and every bus is sized for the longest
+  static const uint16_t LENGTHS[] = { 34, 33, 33 };
+  TEST_ASSERT_EQUAL(before + 3, HostPixelBus::getBuses().size());
+  for (uint8_t i=0; i < 3; i++) {
+    HostPixelBus *bus = HostPixelBus::getBuses()[before + i];
+    TEST_ASSERT_EQUAL(PINS[i], bus->getPin());
+    TEST_ASSERT_EQUAL(i, bus->getChannel());
+    TEST_ASSERT_EQUAL(34, bus->PixelCount());
+  }
+
+  FrameBuffer frame(100);
+  for (uint16_t i=0; i < 100; i++) {
+    frame.setPixel(i, testColor(i));
+  }
+  output->write(frame);
+  output->show();
+
+  // Pixel 34 starts the second run, 67 the third
+  uint16_t offset = 0;
+  for (uint8_t i=0; i < 3; i++) {
+    GrbBus reference(LENGTHS[i], PIN);
+    for (uint16_t j=0; j < LENGTHS[i]; j++) {
+      reference.SetPixelColor(j, testColor(offset + j));
+    }
+    TEST_ASSERT_EQUAL_MEMORY(reference.Pixels(), HostPixelBus::getBuses()[before + i]->getShown().data(), LENGTHS[i] * 3);
+    offset += LENGTHS[i];
+  }
+
+  TEST_ASSERT_EQUAL(34, output->getLongestOutput());
+  TEST_ASSERT_EQUAL_UINT32(34 * 3 * LedOutput::MICROS_PER_BYTE + LedOutput::LATCH_MICROS, output->getExpectedFrameMicros());
+  delete output;
+}
+
+void test_more_pins_make_shorter_frames(void) {
+  LedOutput *one = LedOutput::create(LedOutput::grb);
+  one->configure(1000, 1000, PINS, 1);
+  LedOutput *four = LedOutput::create(LedOutput::grb);
+  four->configure(1000, 1000, PINS, 4);
+
+  // Only the latch isn't shared out
+  TEST_ASSERT_EQUAL_UINT32((one->getExpectedFrameMicros() - LedOutput::LATCH_MICROS) / 4,
+    four->getExpectedFrameMicros() - LedOutput::LATCH_MICROS);
+
+  delete one;
+  delete four;
+}
+
+void test_reserved_room_is_sent_every_frame(void) {
+  size_t before = HostPixelBus::getBuses().size();
+  LedOutput *output = LedOutput::create(LedOutput::grb);
+  output->configure(36, 1000, PINS, 1);
+  output->begin();
+  HostPixelBus *bus = HostPixelBus::getBuses()[before];
+
+  FrameBuffer frame(36);
+  frame.fill(testColor(0));
+  output->write(frame);
+  output->show();
+
+  // The black padding goes out with the lit LEDs
+  TEST_ASSERT_EQUAL(1000 * 3, bus->getShown().size());
+  TEST_ASSERT_EACH_EQUAL_UINT8(0, bus->getShown().data() + 36 * 3, (1000 - 36) * 3);
+  TEST_ASSERT_EQUAL_UINT32(1000 * 3 * LedOutput::MICROS_PER_BYTE + LedOutput::LATCH_MICROS, output->getExpectedFrameMicros());
+  TEST_ASSERT_EQUAL_UINT32(36 * 3 * LedOutput::MICROS_PER_BYTE + LedOutput::LATCH_MICROS, output->getLiveFrameMicros());
+  delete output;
+}
+
+// What reserving room costs in frame time, on one pin
+void test_report_frame_time_with_room_reserved(void) {
+  printf("\n%-12s", "room for");
+  for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+    printf("%10u %6s", STRIP_LENGTHS[n], "fps");
+  }
+  printf("\n");
+
+  for (size_t c=0; c < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); c++) {
+    char layout[16];
+    snprintf(layout, sizeof(layout), "%u LEDs", STRIP_LENGTHS[c]);
+    printf("%-12s", layout);
+
+    for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+      if (STRIP_LENGTHS[n] < STRIP_LENGTHS[c]) {
+        printf("%10s %6s", "", "");
+        continue;
+      }
+      LedOutput *output = LedOutput::create(LedOutput::grb);
+      output->configure(STRIP_LENGTHS[c], STRIP_LENGTHS[n], PINS, 1);
+      uint32_t micros = output->getExpectedFrameMicros();
+      printf("%10u %6u", micros, 1000000 / micros);
+      delete output;
+    }
+    printf("\n");
+  }
+}
+
+void test_report_frame_time_per_layout(void) {
+  static const uint8_t PIN_COUNTS[] = { 1, 2, 4, 8 };
+  static const uint8_t TYPES[] = { LedOutput::grb, LedOutput::grbw };
+  static const char *TYPE_NAMES[] = { "GRB", "GRBW" };
+
+  printf("\n%-12s", "us/frame");
+  for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+    printf("%10u %6s", STRIP_LENGTHS[n], "fps");
+  }
+  printf("\n");
+
+  for (size_t t=0; t < sizeof(TYPES) / sizeof(TYPES[0]); t++) {
+    for (size_t p=0; p < sizeof(PIN_COUNTS) / sizeof(PIN_COUNTS[0]); p++) {
+      if (PIN_COUNTS[p] > LedOutput::MAX_OUTPUTS) {
+        continue;
+      }
+
+      char layout[16];
+      snprintf(layout, sizeof(layout), "%s x%u", TYPE_NAMES[t], PIN_COUNTS[p]);
+      printf("%-12s", layout);
+
+      for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+        LedOutput *output = LedOutput::create(TYPES[t]);
+        output->configure(STRIP_LENGTHS[n], STRIP_LENGTHS[n], PINS, PIN_COUNTS[p]);
+        uint32_t micros = output->getExpectedFrameMicros();
+        printf("%10u %6u", micros, 1000000 / micros);
+        delete output;
+      }
+      printf("\n");
+    }
+  }
+}
+
+void test_dithering_averages_to_the_exact_level(void) {
+  HostPixelBus *bus;
+  LedOutput *output = makeOutput(LedOutput::grb, 36, &bus);
+  output->setCorrection(22, 255, 255, 255);
+  output->setDithering(true);
+  output->setMoving(true);
+
+  // 20 through a 2.2 gamma, in 8.8
+  uint32_t exact = (uint32_t)(powf(20 / 255.0f, 2.2f) * 255.0f * 256.0f + 0.5f);
+  RgbColor dim(20, 20, 20);
+  FrameBuffer frame(36);
+  frame.fill(dim);
+
+  // Every threshold comes round once in 256 frames, so each LED adds up to the 8.8 value
+  uint32_t totals[36] = {};
+  for (int f=0; f < 256; f++) {
+    frame.markDirty();
+    output->write(frame);
+    TEST_ASSERT_TRUE(output->isDithering());
+    for (uint16_t i=0; i < 36; i++) {
+      totals[i] += bus->Pixels()[i * 3];
+    }
+  }
+  for (uint16_t i=0; i < 36; i++) {
+    TEST_ASSERT_EQUAL_UINT32(exact, totals[i]);
+  }
+
+  // Once it stops moving it is rounded to nearest, and stays put
+  output->setMoving(false);
+  frame.markDirty();
+  output->write(frame);
+  TEST_ASSERT_FALSE(output->isDithering());
+  TEST_ASSERT_EQUAL_UINT8((exact + LedOutput::ROUND_TO_NEAREST) >> 8, bus->Pixels()[0]);
+  delete output;
+}
+
+// Times writing the same, already rendered, frames out both ways. Returns how many times faster the bulk write is.
+static double benchmarkWrite(const char *name, FrameBuffer **frames, uint16_t count) {
+  GrbBus bus(count, PIN);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int f=0; f < BENCHMARK_FRAMES; f++) {
+    FrameBuffer& frame = *frames[f & 1];
+    frame.markDirty();
+    setPixelColors(bus, frame);
+  }
+  std::chrono::nanoseconds perPixel = std::chrono::steady_clock::now() - start;
+
+  HostPixelBus *outputBus;
+  LedOutput *output = makeOutput(LedOutput::grb, count, &outputBus);
+  start = std::chrono::steady_clock::now();
+  for (int f=0; f < BENCHMARK_FRAMES; f++) {
+    FrameBuffer& frame = *frames[f & 1];
+    frame.markDirty();
+    output->write(frame);
+  }
+  std::chrono::nanoseconds bulk = std::chrono::steady_clock::now() - start;
+
+  TEST_ASSERT_EQUAL_MEMORY(bus.Pixels(), outputBus->Pixels(), bus.PixelsSize());
+  double speedup = (double)perPixel.count() / bulk.count();
+  printf("%-8s %6u %10.0f %10.0f %8.1fx\n", name, count, (double)perPixel.count() / BENCHMARK_FRAMES,
+    (double)bulk.count() / BENCHMARK_FRAMES, speedup);
+  delete output;
+  return speedup;
+}
+
+void test_benchmark_write(void) {
+  printf("\n%-8s %6s %10s %10s %9s\n", "ns/write", "LEDs", "per pixel", "bulk", "speedup");
+  for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+    uint16_t count = STRIP_LENGTHS[n];
+    FrameBuffer first(count);
+    FrameBuffer second(count);
+    FrameBuffer *frames[] = { &first, &second };
+
+    // One color, as constant, pulse and white draw
+    first.fill(RgbColor(12, 34, 56));
+    second.fill(RgbColor(56, 34, 12));
+    double speedup = benchmarkWrite("uniform", frames, count);
+
+    // Every pixel different, as the effects draw
+    for (uint16_t i=0; i < count; i++) {
+      first.setPixel(i, testColor(i));
+      second.setPixel(i, testColor(i + 1));
+    }
+    benchmarkWrite("mixed", frames, count);
+
+    // A fill is a handful of memcpy()s rather than a conversion per LED, so on a long strip it has to win by a distance
+    if (count >= 1000) {
+      TEST_ASSERT_GREATER_THAN(4, (int)speedup);
+    }
+  }
+}
+
+void test_benchmark_correction(void) {
+  struct Mode {
+    const char *name;
+    uint8_t gamma;
+    bool dithering;
+  };
+  static const Mode MODES[] = {
+    { "linear", 10, false },  // The same as no correction at all
+    { "gamma", 22, false },
+    { "gamma+dither", 22, true },
+  };
+
+  printf("\n%-16s", "ns/write");
+  for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+    printf("%10u", STRIP_LENGTHS[n]);
+  }
+  printf("\n");
+
+  for (size_t m=0; m < sizeof(MODES) / sizeof(MODES[0]); m++) {
+    printf("%-16s", MODES[m].name);
+    for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+      uint16_t count = STRIP_LENGTHS[n];
+      HostPixelBus *bus;
+      LedOutput *output = makeOutput(LedOutput::grb, count, &bus);
+      output->setCorrection(MODES[m].gamma, 255, 255, 255);
+      output->setDithering(MODES[m].dithering);
+      output->setMoving(true);
+
+      // A dim spread of colors, which is where dithering has the most to do
+      FrameBuffer frame(count);
+      for (uint16_t i=0; i < count; i++) {
+        frame.setPixel(i, hsvToRgb(i, 255, 40));
+      }
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (int f=0; f < BENCHMARK_FRAMES; f++) {
+        frame.markDirty();
+        output->write(frame);
+      }
+      std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+      printf("%10.0f", (double)elapsed.count() / BENCHMARK_FRAMES);
+      delete output;
+    }
+    printf("\n");
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_uniform_frame_matches_set_pixel_color);
+  RUN_TEST(test_mixed_frame_matches_set_pixel_color);
+  RUN_TEST(test_rgbw_takes_the_common_part_as_white);
+  RUN_TEST(test_strip_is_split_across_pins);
+  RUN_TEST(test_more_pins_make_shorter_frames);
+  RUN_TEST(test_reserved_room_is_sent_every_frame);
+  RUN_TEST(test_report_frame_time_per_layout);
+  RUN_TEST(test_report_frame_time_with_room_reserved);
+  RUN_TEST(test_dithering_averages_to_the_exact_level);
+  RUN_TEST(test_benchmark_write);
+  RUN_TEST(test_benchmark_correction);
+  return UNITY_END();
+}
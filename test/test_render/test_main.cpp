@@ -0,0 +1,235 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "BambuLights.h"
+
+/*
+ * Runs BambuLights against the recording NeoPixelBus: checks what the strip
+ * is actually sent, and times a frame of every pattern at 36 LEDs (the
+ * default), 255 (the most a byte could count) and 1000.
+ *
+ * Timings are host nanoseconds, so they are for comparing one build with
+ * another rather than for predicting what the ESP32 will do.
+ */
+
+static const int PIN = 27;
+static const uint16_t STRIP_LENGTHS[] = { 36, 255, 1000 };
+static const int BENCHMARK_FRAMES = 2000;
+
+static ByteConfigItem& printingItem(const char *name) {
+  return *(ByteConfigItem*)BambuLights::getPrintingConfig().get(name);
+}
+
+static void setPrintingColor(int hue, uint8_t sat, uint8_t val, uint8_t pattern) {
+  *(IntConfigItem*)BambuLights::getPrintingConfig().get("hue") = hue;
+  printingItem("saturation") = sat;
+  printingItem("value") = val;
+  printingItem("pattern") = pattern;
+}
+
+// Lights with a strip of count LEDs, on the bus they made
+static BambuLights* makeLights(uint16_t count, HostPixelBus **bus) {
+  BambuLights::getNumLEDs() = count;
+  BambuLights *lights = new BambuLights(PIN);
+  *bus = HostPixelBus::getBuses().back();
+  lights->begin();
+  return lights;
+}
+
+// What the LED task does, less the blocking
+static void runFrames(BambuLights& lights, int frames) {
+  for (int i=0; i < frames; i++) {
+    lights.waitForNextFrame();
+    lights.loop();
+  }
+}
+
+void setUp(void) {
+  BambuLights::getNumLEDs() = 36;
+  BambuLights::getMaxLEDs() = 0;
+  BambuLights::getLedType() = LedOutput::grb;
+  BambuLights::getLedPins() = "";
+  BambuLights::getGamma() = 10;
+  BambuLights::getDithering() = true;
+  BambuLights::getMaxMilliamps() = 0;
+  BambuLights::getFadeTime() = 0;
+  setPrintingColor(0, 255, 255, BambuLights::constant);
+}
+
+void tearDown(void) {
+}
+
+void test_white_fills_the_strip(void) {
+  HostPixelBus *bus;
+  BambuLights *lights = makeLights(36, &bus);
+
+  lights->setState(BambuLights::white);
+  runFrames(*lights, 1);
+
+  // Full brightness is 255/256, as it always was with HsbColor
+  TEST_ASSERT_EQUAL(36 * 3, bus->getShown().size());
+  TEST_ASSERT_EACH_EQUAL_UINT8(hsvToRgb(255, 0, 255).R, bus->getShown().data(), bus->getShown().size());
+}
+
+void test_constant_color_goes_out_in_wire_order(void) {
+  HostPixelBus *bus;
+  BambuLights *lights = makeLights(36, &bus);
+
+  setPrintingColor(0, 255, 255, BambuLights::constant);
+  lights->setState(BambuLights::printing);
+  runFrames(*lights, 1);
+
+  // GRB by default
+  RgbColor red = hsvToRgb(0, 255, 255);
+  const std::vector<uint8_t>& shown = bus->getShown();
+  for (int i=0; i < 36; i++) {
+    TEST_ASSERT_EQUAL_UINT8(red.G, shown[i * 3]);
+    TEST_ASSERT_EQUAL_UINT8(red.R, shown[i * 3 + 1]);
+    TEST_ASSERT_EQUAL_UINT8(red.B, shown[i * 3 + 2]);
+  }
+}
+
+void test_still_picture_is_not_resent(void) {
+  HostPixelBus *bus;
+  BambuLights *lights = makeLights(36, &bus);
+
+  BambuLights::getFadeTime() = 500;
+  BambuLights::getGamma() = 22;
+  setPrintingColor(40, 200, 100, BambuLights::constant);
+  lights->setState(BambuLights::printing);
+
+  // Through the fade, and the frame that rounds what it left behind
+  runFrames(*lights, 40);
+  TEST_ASSERT_FALSE(lights->isAnimating());
+
+  uint32_t shows = bus->getShows();
+  runFrames(*lights, 100);
+  TEST_ASSERT_EQUAL_UINT32(shows, bus->getShows());
+}
+
+void test_dim_state_is_only_dithered_while_fading(void) {
+  HostPixelBus *bus;
+  BambuLights *lights = makeLights(36, &bus);
+
+  // Value 128, white: the default printer color, which falls between gamma corrected levels
+  BambuLights::getFadeTime() = 500;
+  BambuLights::getGamma() = 22;
+  lights->setState(BambuLights::printer);
+
+  // Every frame of the fade goes out
+  uint32_t shows = bus->getShows();
+  runFrames(*lights, 10);
+  TEST_ASSERT_TRUE(lights->isAnimating());
+  TEST_ASSERT_EQUAL_UINT32(shows + 10, bus->getShows());
+
+  runFrames(*lights, 30);
+  TEST_ASSERT_FALSE(lights->isAnimating());
+  shows = bus->getShows();
+  runFrames(*lights, 100);
+  TEST_ASSERT_EQUAL_UINT32(shows, bus->getShows());
+}
+
+void test_fade_longer_than_a_minute_runs_to_the_end(void) {
+  HostPixelBus *bus;
+  BambuLights *lights = makeLights(36, &bus);
+
+  // More than 16 bits of milliseconds
+  BambuLights::getFadeTime() = 70000;
+  lights->setState(BambuLights::printing);
+  runFrames(*lights, 1);
+
+  advanceMillis(66000);
+  runFrames(*lights, 1);
+  TEST_ASSERT_TRUE(lights->isAnimating());
+
+  advanceMillis(4000);
+  runFrames(*lights, 2);
+  TEST_ASSERT_FALSE(lights->isAnimating());
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(70000, lights->getLastFadeMillis());
+}
+
+void test_every_pattern_lights_the_strip(void) {
+  for (uint8_t pattern=0; pattern < BambuLights::num_patterns; pattern++) {
+    HostPixelBus *bus;
+    BambuLights *lights = makeLights(36, &bus);
+
+    setPrintingColor(100, 255, 255, pattern);
+    lights->setProgress(50);
+    lights->setState(BambuLights::printing);
+    runFrames(*lights, 10);
+
+    const std::vector<uint8_t>& shown = bus->getShown();
+    int lit = 0;
+    for (size_t i=0; i < shown.size(); i++) {
+      lit += shown[i] != 0;
+    }
+    TEST_ASSERT_GREATER_THAN_MESSAGE(0, lit, BambuLights::patterns_str[pattern].c_str());
+  }
+}
+
+static double nanosPerFrame(BambuLights& lights, int frames) {
+  std::chrono::nanoseconds total(0);
+  for (int i=0; i < frames; i++) {
+    lights.waitForNextFrame();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    lights.loop();
+    total += std::chrono::steady_clock::now() - start;
+  }
+  return (double)total.count() / frames;
+}
+
+void test_benchmark_patterns(void) {
+  BambuLights::getGamma() = 22;
+
+  printf("\n%-10s", "ns/frame");
+  for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+    printf("%10u", STRIP_LENGTHS[n]);
+  }
+  printf("\n");
+
+  for (uint8_t pattern=0; pattern < BambuLights::num_patterns; pattern++) {
+    printf("%-10s", BambuLights::patterns_str[pattern].c_str());
+    for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+      HostPixelBus *bus;
+      BambuLights *lights = makeLights(STRIP_LENGTHS[n], &bus);
+
+      setPrintingColor(100, 255, 200, pattern);
+      lights->setProgress(37);
+      lights->setState(BambuLights::printing);
+      runFrames(*lights, 1);
+
+      printf("%10.0f", nanosPerFrame(*lights, BENCHMARK_FRAMES));
+      TEST_ASSERT_GREATER_THAN(0, bus->getShows());
+    }
+    printf("\n");
+  }
+
+  // Fading back and forth between two states, so every frame is a new color
+  BambuLights::getFadeTime() = 500;
+  setPrintingColor(100, 255, 200, BambuLights::constant);
+  printf("%-10s", "Fade");
+  for (size_t n=0; n < sizeof(STRIP_LENGTHS) / sizeof(STRIP_LENGTHS[0]); n++) {
+    HostPixelBus *bus;
+    BambuLights *lights = makeLights(STRIP_LENGTHS[n], &bus);
+
+    double total = 0;
+    for (int i=0; i < BENCHMARK_FRAMES / 20; i++) {
+      lights->setState(i % 2 ? BambuLights::printing : BambuLights::printer);
+      total += nanosPerFrame(*lights, 20);
+    }
+    printf("%10.0f", total / (BENCHMARK_FRAMES / 20));
+  }
+  printf("\n");
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_white_fills_the_strip);
+  RUN_TEST(test_constant_color_goes_out_in_wire_order);
+  RUN_TEST(test_still_picture_is_not_resent);
+  RUN_TEST(test_dim_state_is_only_dithered_while_fading);
+  RUN_TEST(test_fade_longer_than_a_minute_runs_to_the_end);
+  RUN_TEST(test_every_pattern_lights_the_strip);
+  RUN_TEST(test_benchmark_patterns);
+  return UNITY_END();
+}
@@ -0,0 +1,425 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include <string>
+#include "MQTTBroker.h"
+
+/*
+ * Printer reports replayed through MQTTBroker as the MQTT client would hand
+ * them over, fragments and all: a synthetic print session, written by hand
+ * in the shape of the printer's push_status reports, from connecting to
+ * disconnecting, checking the state, door and light the lights would show
+ * after each report. Then docs/message.json, a real full report, and what
+ * each report costs to filter and parse.
+ *
+ * The host clock only moves when a test moves it, so the broker's own
+ * histograms would show every report taking no time at all. Times here
+ * are measured around the calls instead.
+ */
+
+static const char *SERIAL_NUMBER = "01S00A000000000";
+static const char *REPORT_TOPIC = "device/01S00A000000000/report";
+static const size_t FRAGMENT = 1024;
+static const int BENCHMARK_REPORTS = 2000;
+
+struct Step {
+  const char *name;
+  const char *report;
+  MQTTBroker::State state;
+  bool doorOpen;
+  bool lightOn;
+};
+
+// One print, in the order the printer would send them. Only the first report has everything, the rest only what changed.
+static const Step SESSION[] = {
+  { "idle", R"({"print":{"command":"push_status","stg_cur":255,"gcode_state":"IDLE","home_flag":6409655,"mc_percent":0,)"
+      R"("lights_report":[{"node":"chamber_light","mode":"on"},{"node":"work_light","mode":"flashing"}],"hms":[],"print_error":0}})",
+    MQTTBroker::idle, false, true },
+  { "door opened", R"({"print":{"command":"push_status","home_flag":14798263,"sequence_id":"2"}})",
+    MQTTBroker::idle, true, true },
+  { "door closed", R"({"print":{"command":"push_status","home_flag":"6409655","sequence_id":"3"}})",
+    MQTTBroker::idle, false, true },
+  { "preheating", R"({"print":{"command":"push_status","stg_cur":2,"gcode_state":"PREPARE","bed_target_temper":55}})",
+    MQTTBroker::printing, false, true },
+  { "lidar", R"({"print":{"command":"push_status","stg_cur":12,"gcode_state":"RUNNING"}})",
+    MQTTBroker::no_lights, false, true },
+  { "printing", R"({"print":{"command":"push_status","stg_cur":0,"mc_percent":10,"layer_num":3,"total_layer_num":120}})",
+    MQTTBroker::printing, false, true },
+  { "light off", R"({"print":{"command":"push_status","lights_report":[{"node":"chamber_light","mode":"off"}]}})",
+    MQTTBroker::printing, false, false },
+  { "light on", R"({"print":{"command":"push_status","lights_report":[{"node":"chamber_light","mode":"on"}]}})",
+    MQTTBroker::printing, false, true },
+  // HMS_0300_0100_0003_0007, a common one
+  { "hms warning", R"({"print":{"command":"push_status","hms":[{"attr":50331904,"code":196615}]}})",
+    MQTTBroker::warning, false, true },
+  // HMS_0300_0100_0001_0007, a fatal one
+  { "hms error", R"({"print":{"command":"push_status","hms":[{"attr":50331904,"code":65543}]}})",
+    MQTTBroker::error, false, true },
+  { "hms cleared", R"({"print":{"command":"push_status","stg_cur":0,"hms":[]}})",
+    MQTTBroker::printing, false, true },
+  // 0300_8011, which is only a warning
+  { "print warning", R"({"print":{"command":"push_status","print_error":50364433}})",
+    MQTTBroker::warning, false, true },
+  { "paused", R"({"print":{"command":"push_status","stg_cur":16,"gcode_state":"PAUSE","print_error":0}})",
+    MQTTBroker::printing, false, true },
+  { "filament runout", R"({"print":{"command":"push_status","stg_cur":6}})",
+    MQTTBroker::error, false, true },
+  // HMS_0C00_0300_0003_000B, the camera is in use
+  { "camera in use", R"({"print":{"command":"push_status","stg_cur":0,"hms":[{"attr":201327360,"code":196619}]}})",
+    MQTTBroker::no_lights, false, true },
+  { "finished", R"({"print":{"command":"push_status","stg_cur":255,"gcode_state":"FINISH","mc_percent":100,"hms":[]}})",
+    MQTTBroker::idle, false, true },
+};
+static const int NUM_STEPS = sizeof(SESSION) / sizeof(SESSION[0]);
+
+// Has none of the keys the broker looks at
+static const char *INFO_REPORT = R"({"info":{"command":"get_version","sequence_id":"0","module":[{"name":"ota","sw_ver":"01.07.00.00"}]}})";
+
+// Deltas the printer sends between the ones that matter. Only the last has anything the lights look at.
+struct Delta {
+  const char *name;
+  const char *report;
+};
+
+static const Delta DELTAS[] = {
+  { "wifi_signal", R"({"print":{"command":"push_status","msg":1,"sequence_id":"2041","wifi_signal":"-52dBm"}})" },
+  { "gcode_line", R"({"print":{"command":"gcode_line","param":"M400\\n","reason":"success","result":"success","sequence_id":"2042"}})" },
+  { "get_version", INFO_REPORT },
+  { "nozzle_temper", R"({"print":{"command":"push_status","msg":1,"sequence_id":"2043","nozzle_temper":219.8}})" },
+};
+static const int NUM_DELTAS = sizeof(DELTAS) / sizeof(DELTAS[0]);
+
+static std::string message;
+static MQTTBroker *broker;
+static espMqttClientSecure *client;
+
+// The project directory is the working directory under pio test, but not necessarily elsewhere
+static std::string readProjectFile(const char *path) {
+  std::string dir = __FILE__;
+  std::string candidates[] = {
+    path,
+    dir.substr(0, dir.rfind("test/test_replay")) + path,
+    std::string("../../") + path,
+  };
+
+  for (const std::string& candidate : candidates) {
+    FILE *file = fopen(candidate.c_str(), "rb");
+    if (file) {
+      std::string contents;
+      char buf[4096];
+      size_t n;
+      while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        contents.append(buf, n);
+      }
+      fclose(file);
+      return contents;
+    }
+  }
+
+  return std::string();
+}
+
+// A broker that has been set up and connected, as main.cpp would leave it
+static void makeConnectedBroker() {
+  broker = new MQTTBroker();
+  client = espMqttClientSecure::getClients().back();
+  TEST_ASSERT_TRUE(broker->init("bambulights-test"));
+
+  broker->connect();
+  client->connectTo();
+  broker->parsePending();
+}
+
+static uint32_t replay(const char *report, size_t fragment = FRAGMENT) {
+  client->deliver(REPORT_TOPIC, report, strlen(report), fragment);
+  return broker->parsePending();
+}
+
+static void assertStep(const Step& step) {
+  TEST_ASSERT_EQUAL_MESSAGE(step.state, broker->getState(), step.name);
+  TEST_ASSERT_EQUAL_MESSAGE(step.doorOpen, broker->isDoorOpen(), step.name);
+  TEST_ASSERT_EQUAL_MESSAGE(step.lightOn, broker->isLightOn(), step.name);
+}
+
+void setUp(void) {
+  MQTTBroker::getHost() = "192.168.1.10";
+  MQTTBroker::getSerialNumber() = SERIAL_NUMBER;
+  makeConnectedBroker();
+}
+
+void tearDown(void) {
+  delete broker;
+  broker = 0;
+  client = 0;
+}
+
+void test_connecting_subscribes_and_goes_idle(void) {
+  TEST_ASSERT_EQUAL_STRING("192.168.1.10", client->getHost().c_str());
+  TEST_ASSERT_EQUAL(8883, client->getPort());
+  TEST_ASSERT_EQUAL(1, client->getConnectRequests());
+  TEST_ASSERT_EQUAL(1, client->getSubscriptions().size());
+  TEST_ASSERT_EQUAL_STRING(REPORT_TOPIC, client->getSubscriptions()[0].c_str());
+
+  TEST_ASSERT_TRUE(broker->isConnected());
+  TEST_ASSERT_EQUAL(MQTTBroker::idle, broker->getState());
+}
+
+void test_session_transitions(void) {
+  for (int i=0; i < NUM_STEPS; i++) {
+    replay(SESSION[i].report);
+    assertStep(SESSION[i]);
+  }
+
+  TEST_ASSERT_EQUAL(NUM_STEPS, broker->getReportCount());
+  TEST_ASSERT_EQUAL(NUM_STEPS, broker->getParseTimes().getCount());
+  TEST_ASSERT_EQUAL(0, broker->getDroppedReports());
+  TEST_ASSERT_EQUAL(100, broker->getPercent());
+  TEST_ASSERT_EQUAL(120, broker->getTotalLayers());
+  TEST_ASSERT_EQUAL_STRING("FINISH", broker->getPrinterState().gcodeState);
+}
+
+void test_fragmenting_makes_no_difference(void) {
+  static const size_t FRAGMENTS[] = { 1, 2, 7, 64 };
+  for (size_t fragment : FRAGMENTS) {
+    tearDown();
+    makeConnectedBroker();
+    for (int i=0; i < NUM_STEPS; i++) {
+      replay(SESSION[i].report, fragment);
+      assertStep(SESSION[i]);
+    }
+    TEST_ASSERT_EQUAL(0, broker->getDroppedReports());
+  }
+}
+
+void test_only_changes_are_reported(void) {
+  uint32_t changed = replay(SESSION[0].report);
+  TEST_ASSERT_TRUE(changed & PrinterState::GCODE_STATE);
+  TEST_ASSERT_TRUE(changed & PrinterState::STAGE);
+
+  // The same again changes nothing
+  TEST_ASSERT_EQUAL_HEX32(0, replay(SESSION[0].report));
+
+  TEST_ASSERT_EQUAL_HEX32(PrinterState::DOOR, replay(SESSION[1].report));
+  TEST_ASSERT_EQUAL_HEX32(PrinterState::CHAMBER_LIGHT, replay(SESSION[6].report));
+}
+
+void test_reports_without_our_keys_are_skipped(void) {
+  uint32_t stateChanges = broker->getStateChanges();
+  TEST_ASSERT_EQUAL_HEX32(0, replay(INFO_REPORT, 7));
+
+  TEST_ASSERT_EQUAL(1, broker->getSkippedReports());
+  TEST_ASSERT_EQUAL(0, broker->getParseTimes().getCount());
+  TEST_ASSERT_EQUAL(stateChanges, broker->getStateChanges());
+}
+
+void test_deltas_are_skipped_unless_they_have_our_keys(void) {
+  for (int i=0; i < NUM_DELTAS; i++) {
+    replay(DELTAS[i].report);
+  }
+  TEST_ASSERT_EQUAL(NUM_DELTAS - 1, broker->getSkippedReports());
+  TEST_ASSERT_EQUAL(1, broker->getParseTimes().getCount());
+  TEST_ASSERT_EQUAL_FLOAT(219.8f, broker->getPrinterState().nozzleTemp);
+
+  // Parsing them anyway changes nothing
+  broker->setSkipReports(false);
+  for (int i=0; i < NUM_DELTAS - 1; i++) {
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE(0, replay(DELTAS[i].report), DELTAS[i].name);
+  }
+  TEST_ASSERT_EQUAL(NUM_DELTAS, broker->getParseTimes().getCount());
+}
+
+void test_truncated_report_is_dropped(void) {
+  replay(SESSION[0].report);
+
+  // All the client got of the door opening
+  std::string truncated = std::string(SESSION[1].report, strlen(SESSION[1].report) - 2);
+  TEST_ASSERT_EQUAL_HEX32(0, replay(truncated.c_str()));
+
+  TEST_ASSERT_EQUAL(1, broker->getDroppedReports());
+  assertStep(SESSION[0]);
+}
+
+void test_reports_waiting_together_are_notified_once(void) {
+  broker->setNotifyTask(xTaskGetCurrentTaskHandle());
+
+  for (int i=0; i < 3; i++) {
+    client->deliver(REPORT_TOPIC, SESSION[i].report, strlen(SESSION[i].report), FRAGMENT);
+  }
+  uint32_t stateChanges = broker->getStateChanges();
+  broker->parsePending();
+
+  TEST_ASSERT_EQUAL(stateChanges + 1, broker->getStateChanges());
+  TEST_ASSERT_EQUAL(2, broker->getCoalescedReports());
+  assertStep(SESSION[2]);
+
+  MQTTBroker::Snapshot snapshot;
+  TEST_ASSERT_TRUE(broker->receiveSnapshot(snapshot));
+  TEST_ASSERT_TRUE(snapshot.changed & PrinterState::GCODE_STATE);
+  TEST_ASSERT_EQUAL(MQTTBroker::idle, snapshot.state);
+  TEST_ASSERT_FALSE(snapshot.printer.doorOpen);
+  TEST_ASSERT_FALSE(broker->receiveSnapshot(snapshot));
+}
+
+void test_disconnect(void) {
+  replay(SESSION[4].report);
+  client->disconnectFrom();
+  uint32_t changed = broker->parsePending();
+
+  TEST_ASSERT_TRUE(changed & PrinterState::CONNECTION);
+  TEST_ASSERT_FALSE(broker->isConnected());
+  TEST_ASSERT_EQUAL(MQTTBroker::disconnected, broker->getState());
+
+  // Nothing is asked of a printer that isn't there
+  broker->setChamberLight(true);
+  TEST_ASSERT_EQUAL(0, client->getPublished().size());
+}
+
+void test_snapshots_collect_changes_until_received(void) {
+  broker->setNotifyTask(xTaskGetCurrentTaskHandle());
+
+  // Two reports before the task gets round to them
+  replay(SESSION[1].report);
+  replay(SESSION[6].report);
+
+  MQTTBroker::Snapshot snapshot;
+  TEST_ASSERT_TRUE(broker->receiveSnapshot(snapshot));
+  TEST_ASSERT_EQUAL_HEX32(PrinterState::DOOR | PrinterState::CHAMBER_LIGHT, snapshot.changed);
+  TEST_ASSERT_EQUAL(broker->getState(), snapshot.state);
+  TEST_ASSERT_EQUAL(broker->isDoorOpen(), snapshot.printer.doorOpen);
+  TEST_ASSERT_EQUAL(broker->isLightOn(), snapshot.printer.lightOn);
+  TEST_ASSERT_FALSE(broker->receiveSnapshot(snapshot));
+}
+
+void test_other_tasks_get_a_copy(void) {
+  broker->setNotifyTask(xTaskGetCurrentTaskHandle());
+  replay(SESSION[4].report);
+  replay(SESSION[5].report);
+
+  // Whether or not the notify task has taken its own
+  MQTTBroker::Snapshot snapshot;
+  TEST_ASSERT_TRUE(broker->receiveSnapshot(snapshot));
+  broker->getSnapshot(snapshot);
+  TEST_ASSERT_EQUAL(MQTTBroker::printing, snapshot.state);
+  TEST_ASSERT_EQUAL(10, snapshot.printer.percent);
+  TEST_ASSERT_EQUAL(120, snapshot.printer.totalLayers);
+  TEST_ASSERT_EQUAL_STRING(broker->getPrinterState().gcodeState, snapshot.printer.gcodeState);
+}
+
+void test_chamber_light_request(void) {
+  broker->setChamberLight(false);
+
+  TEST_ASSERT_EQUAL(1, client->getPublished().size());
+  TEST_ASSERT_EQUAL_STRING("device/01S00A000000000/request", client->getPublished()[0].first.c_str());
+  TEST_ASSERT_NOT_NULL(strstr(client->getPublished()[0].second.c_str(), "\"led_mode\": \"off\""));
+}
+
+void test_message_json(void) {
+  replay(message.c_str());
+
+  // stg_cur 14 would be printing, but print_error 0300_8011 makes it a warning
+  TEST_ASSERT_EQUAL(MQTTBroker::warning, broker->getState());
+  TEST_ASSERT_FALSE(broker->isDoorOpen());
+  TEST_ASSERT_TRUE(broker->isLightOn());
+  TEST_ASSERT_EQUAL(14, broker->getPrinterState().stage);
+  TEST_ASSERT_EQUAL_STRING("PAUSE", broker->getPrinterState().gcodeState);
+  TEST_ASSERT_EQUAL(40, broker->getPercent());
+  TEST_ASSERT_EQUAL(43, broker->getPrinterState().trays[0].remain);
+  TEST_ASSERT_EQUAL_HEX32(0x8E9089FF, broker->getPrinterState().trays[1].color);
+
+  TEST_ASSERT_EQUAL(0, broker->getDroppedReports());
+  TEST_ASSERT_GREATER_THAN(0, broker->getParseAllocations());
+  TEST_ASSERT_GREATER_THAN(0, broker->getParsePeakBytes());
+}
+
+// Filters and parses report BENCHMARK_REPORTS times on a fresh broker. Returns the parse time, and how many were parsed.
+static double timeReport(const char *report, uint32_t *parsedReports, double *filterNanos = 0) {
+  size_t length = strlen(report);
+  std::chrono::nanoseconds filtered(0);
+  std::chrono::nanoseconds parsed(0);
+  for (int i=0; i < BENCHMARK_REPORTS; i++) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    client->deliver(REPORT_TOPIC, report, length, FRAGMENT);
+    std::chrono::steady_clock::time_point delivered = std::chrono::steady_clock::now();
+    broker->parsePending();
+    parsed += std::chrono::steady_clock::now() - delivered;
+    filtered += delivered - start;
+  }
+
+  *parsedReports = broker->getParseTimes().getCount();
+  if (filterNanos) {
+    *filterNanos = (double)filtered.count() / BENCHMARK_REPORTS;
+  }
+  return (double)parsed.count() / BENCHMARK_REPORTS;
+}
+
+// Prints a row of the table for report
+static void benchmarkReport(const char *name, const char *report) {
+  tearDown();
+  makeConnectedBroker();
+
+  uint32_t parsedReports;
+  double filterNanos;
+  double parseNanos = timeReport(report, &parsedReports, &filterNanos);
+
+  TEST_ASSERT_EQUAL(BENCHMARK_REPORTS, parsedReports);
+  printf("%-16s %8u %8u %10.0f %10.0f %8u %8u\n", name, (unsigned)strlen(report), (unsigned)broker->getLargestFiltered(),
+    filterNanos, parseNanos, broker->getParseAllocations(), (unsigned)broker->getParsePeakBytes());
+}
+
+// Prints what report costs to parse with skipping, and with it turned off as it was before
+static void benchmarkSkip(const char *name, const char *report) {
+  tearDown();
+  makeConnectedBroker();
+  uint32_t parsedSkipping;
+  double skipping = timeReport(report, &parsedSkipping);
+
+  tearDown();
+  makeConnectedBroker();
+  broker->setSkipReports(false);
+  uint32_t parsedAll;
+  double all = timeReport(report, &parsedAll);
+
+  TEST_ASSERT_EQUAL(BENCHMARK_REPORTS, parsedAll);
+  printf("%-16s %8u %8s %10.0f %10.0f\n", name, (unsigned)strlen(report), parsedSkipping ? "parsed" : "skipped", all, skipping);
+}
+
+void test_benchmark_reports(void) {
+  printf("\n%-16s %8s %8s %10s %10s %8s %8s\n", "report", "bytes", "kept", "filter ns", "parse ns", "allocs", "peak");
+  benchmarkReport("message.json", message.c_str());
+  for (int i=0; i < NUM_STEPS; i++) {
+    benchmarkReport(SESSION[i].name, SESSION[i].report);
+  }
+}
+
+void test_benchmark_skipped_reports(void) {
+  printf("\n%-16s %8s %8s %10s %10s\n", "parse ns", "bytes", "", "before", "after");
+  for (int i=0; i < NUM_DELTAS; i++) {
+    benchmarkSkip(DELTAS[i].name, DELTAS[i].report);
+  }
+}
+
+int main() {
+  message = readProjectFile("docs/message.json");
+
+  UNITY_BEGIN();
+  if (message.empty()) {
+    printf("docs/message.json not found, run from the project directory\n");
+    return 1;
+  }
+  RUN_TEST(test_connecting_subscribes_and_goes_idle);
+  RUN_TEST(test_session_transitions);
+  RUN_TEST(test_fragmenting_makes_no_difference);
+  RUN_TEST(test_only_changes_are_reported);
+  RUN_TEST(test_reports_without_our_keys_are_skipped);
+  RUN_TEST(test_deltas_are_skipped_unless_they_have_our_keys);
+  RUN_TEST(test_truncated_report_is_dropped);
+  RUN_TEST(test_reports_waiting_together_are_notified_once);
+  RUN_TEST(test_disconnect);
+  RUN_TEST(test_snapshots_collect_changes_until_received);
+  RUN_TEST(test_other_tasks_get_a_copy);
+  RUN_TEST(test_chamber_light_request);
+  RUN_TEST(test_message_json);
+  RUN_TEST(test_benchmark_reports);
+  RUN_TEST(test_benchmark_skipped_reports);
+  return UNITY_END();
+}